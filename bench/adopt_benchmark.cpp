@@ -0,0 +1,44 @@
+#include <cstdint>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "min_max_heap.hpp"
+
+namespace {
+
+void Run(const std::int64_t n) {
+	const auto keys = benchmark::RandomKeys(n);
+
+	auto result = benchmark::Measure(n, benchmark::PerfCounter::None(), [&] {
+		MinMaxHeap<std::uint64_t> heap{keys.cbegin(), keys.cend()};
+		std::vector<std::uint64_t> sorted;
+		sorted.reserve(keys.size());
+		while (heap.Size() > 0) sorted.push_back(heap.RemoveMin());
+		benchmark::DoNotOptimize(sorted.data());
+	});
+	benchmark::Report("adopt", "copy+pop_all", n, result);
+
+	// the copies of the keys that the adopting round trips consume are made outside of the measurement
+	auto buffer = keys;
+	result = benchmark::Measure(n, benchmark::PerfCounter::None(), [&] {
+		MinMaxHeap<std::uint64_t> heap{std::move(buffer)};
+		buffer = std::move(heap).Release();
+		benchmark::DoNotOptimize(buffer.data());
+	});
+	benchmark::Report("adopt", "adopt+release", n, result);
+
+	buffer = keys;
+	result = benchmark::Measure(n, benchmark::PerfCounter::None(), [&] {
+		MinMaxHeap<std::uint64_t> heap{std::move(buffer)};
+		buffer = std::move(heap).TakeSorted();
+		benchmark::DoNotOptimize(buffer.data());
+	});
+	benchmark::Report("adopt", "adopt+take_sorted", n, result);
+}
+}
+
+BENCHMARK_SUITE(adopt) {
+	for (const auto n : options.SizesOr({10'000'000})) {
+		Run(n);
+	}
+}
@@ -0,0 +1,55 @@
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "min_max_heap.hpp"
+#include "offset_min_max_heap.hpp"
+
+namespace {
+
+// An aging scheduler over n waiting tasks: every tick, a batch of tasks arrives at base priority, the same number
+// of highest priority tasks is dispatched, and every task still waiting gains one unit of priority.
+constexpr auto kArrivalsPerTick = 16;
+
+std::vector<std::int64_t> Priorities(const std::int64_t count) {
+	auto keys = benchmark::RandomKeys(count);
+	std::vector<std::int64_t> priorities(keys.size());
+	for (std::size_t i = 0; i < keys.size(); ++i) priorities[i] = static_cast<std::int64_t>(keys[i] % 1'000'000);
+	return priorities;
+}
+
+template <typename Heap, typename Age>
+void Run(const std::string& name, const std::int64_t n, const std::int64_t ticks, Age&& age) {
+	const auto priorities = Priorities(n + ticks * kArrivalsPerTick);
+	Heap heap{priorities.cbegin(), priorities.cbegin() + n};
+
+	const auto result = benchmark::Measure(ticks, benchmark::PerfCounter::None(), [&] {
+		auto next = priorities.cbegin() + n;
+		for (auto tick = 0; tick < ticks; ++tick) {
+			for (auto i = 0; i < kArrivalsPerTick; ++i) heap.Add(*next++);
+			for (auto i = 0; i < kArrivalsPerTick; ++i) benchmark::DoNotOptimize(heap.RemoveMax());
+			age(heap);
+		}
+	});
+	benchmark::Report("aging", name + "/per_tick", n, result);
+}
+}
+
+BENCHMARK_SUITE(aging) {
+	for (const auto n : options.SizesOr({10'000, 1'000'000})) {
+		// the O(n) baselines run fewer ticks on large heaps
+		const auto slow_ticks = std::max<std::int64_t>(100, 1'000'000'000 / (n * 100));
+
+		Run<MinMaxHeap<std::int64_t>>("rebuild", n, slow_ticks, [](auto& heap) {
+			auto data = std::move(heap).Release();
+			for (auto& priority : data) ++priority;
+			heap = MinMaxHeap<std::int64_t>{std::move(data)};
+		});
+		Run<MinMaxHeap<std::int64_t>>("transform_all", n, slow_ticks,
+			[](auto& heap) { heap.TransformAll([](const std::int64_t priority) { return priority + 1; }); });
+		Run<OffsetMinMaxHeap<std::int64_t>>("shift_all", n, 100'000, [](auto& heap) { heap.ShiftAll(1); });
+	}
+}
@@ -0,0 +1,83 @@
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "min_max_heap.hpp"
+
+namespace {
+
+template <int Arity>
+struct ArityPolicy : MinMaxHeapPolicy {
+	static constexpr int kArity = Arity;
+};
+
+// a 32 byte record ordered by its first field
+struct WideKey {
+	explicit WideKey(const std::uint64_t key = 0) noexcept : key{key}, payload{} {}
+
+	std::uint64_t key;
+	std::uint64_t payload[3];
+
+	bool operator<(const WideKey& other) const noexcept { return key < other.key; }
+	bool operator>(const WideKey& other) const noexcept { return key > other.key; }
+};
+}
+
+template <>
+struct IsCheaplyComparable<WideKey> : std::true_type {};
+
+namespace {
+
+template <typename Key, int Arity>
+void Run(const char* const key_name, const std::int64_t n) {
+	const auto random = benchmark::RandomKeys(n);
+	const auto refill_keys = benchmark::RandomKeys(std::min<std::int64_t>(n, 1'000'000), 7);
+	std::vector<Key> keys(random.size());
+	std::vector<Key> refills(refill_keys.size());
+	std::transform(random.cbegin(), random.cend(), keys.begin(), [](const auto key) { return static_cast<Key>(key); });
+	std::transform(refill_keys.cbegin(), refill_keys.cend(), refills.begin(), [](const auto key) { return static_cast<Key>(key); });
+
+	const auto operations = static_cast<std::int64_t>(refills.size());
+	const auto name = std::string{key_name} + "/arity=" + std::to_string(Arity);
+
+	auto result = benchmark::Measure(n, benchmark::PerfCounter::None(), [&] {
+		MinMaxHeap<Key, ArityPolicy<Arity>> heap{keys.cbegin(), keys.cend()};
+		benchmark::DoNotOptimize(heap.Min());
+	});
+	benchmark::Report("arity", name + "/build", n, result);
+
+	MinMaxHeap<Key, ArityPolicy<Arity>> heap{keys.cbegin(), keys.cend()};
+	result = benchmark::Measure(operations, benchmark::PerfCounter::None(), [&] {
+		for (const auto& refill : refills) {
+			benchmark::DoNotOptimize(heap.RemoveMin());
+			heap.Add(refill);
+		}
+	});
+	benchmark::Report("arity", name + "/remove_min+add", n, result);
+
+	result = benchmark::Measure(operations, benchmark::PerfCounter::None(), [&] {
+		for (const auto& refill : refills) {
+			benchmark::DoNotOptimize(heap.RemoveMax());
+			heap.Add(refill);
+		}
+	});
+	benchmark::Report("arity", name + "/remove_max+add", n, result);
+}
+
+template <typename Key>
+void RunArities(const char* const key_name, const std::int64_t n) {
+	Run<Key, 2>(key_name, n);
+	Run<Key, 4>(key_name, n);
+	Run<Key, 8>(key_name, n);
+}
+}
+
+BENCHMARK_SUITE(arity) {
+	for (const auto n : options.SizesOr({1'000'000, 16'000'000})) {
+		RunArities<std::uint32_t>("uint32", n);
+		RunArities<std::uint64_t>("uint64", n);
+		RunArities<WideKey>("32-byte", n);
+	}
+}
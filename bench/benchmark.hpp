@@ -0,0 +1,228 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace benchmark {
+
+class PerfCounter {
+
+public:
+	static PerfCounter None() { return PerfCounter{"", 0, 0}; }
+#ifdef __linux__
+	static PerfCounter BranchMisses() { return PerfCounter{"branch-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}; }
+	static PerfCounter CacheMisses() { return PerfCounter{"cache-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES}; }
+	static PerfCounter DtlbMisses() {
+		return PerfCounter{"dTLB-load-misses", PERF_TYPE_HW_CACHE,
+			PERF_COUNT_HW_CACHE_DTLB | PERF_COUNT_HW_CACHE_OP_READ << 8 | PERF_COUNT_HW_CACHE_RESULT_MISS << 16};
+	}
+#else
+	static PerfCounter BranchMisses() { return PerfCounter{"branch-misses", 0, 0}; }
+	static PerfCounter CacheMisses() { return PerfCounter{"cache-misses", 0, 0}; }
+	static PerfCounter DtlbMisses() { return PerfCounter{"dTLB-load-misses", 0, 0}; }
+#endif
+
+	PerfCounter(const PerfCounter&) = delete;
+	PerfCounter& operator=(const PerfCounter&) = delete;
+
+	PerfCounter(PerfCounter&& other) noexcept : name_{other.name_}, fd_{other.fd_} { other.fd_ = -1; }
+
+	~PerfCounter() {
+#ifdef __linux__
+		if (fd_ >= 0) close(fd_);
+#endif
+	}
+
+	[[nodiscard]] const char* Name() const noexcept { return name_; }
+
+	void Start() const {
+#ifdef __linux__
+		if (fd_ < 0) return;
+		ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+		ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+	}
+
+	// returns the number of events counted since Start or -1 if the counter is unavailable on this machine
+	[[nodiscard]] std::int64_t Stop() const {
+#ifdef __linux__
+		if (fd_ < 0) return -1;
+		ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+		std::int64_t count = 0;
+		return read(fd_, &count, sizeof count) == sizeof count ? count : -1;
+#else
+		return -1;
+#endif
+	}
+
+private:
+	PerfCounter(const char* const name, [[maybe_unused]] const std::uint32_t type, [[maybe_unused]] const std::uint64_t config)
+		: name_{name} {
+#ifdef __linux__
+		if (*name == '\0') return;
+		perf_event_attr attributes;
+		std::memset(&attributes, 0, sizeof attributes);
+		attributes.size = sizeof attributes;
+		attributes.type = type;
+		attributes.config = config;
+		attributes.disabled = 1;
+		attributes.exclude_kernel = 1;
+		attributes.exclude_hv = 1;
+		fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+#endif
+	}
+
+	const char* name_;
+	int fd_ = -1;
+};
+
+struct Options {
+	std::vector<std::int64_t> sizes;
+
+	[[nodiscard]] std::vector<std::int64_t> SizesOr(std::vector<std::int64_t> defaults) const {
+		return sizes.empty() ? defaults : sizes;
+	}
+};
+
+struct Suite {
+	const char* name;
+	void (*run)(const Options&);
+};
+
+inline std::vector<Suite>& Registry() {
+	static std::vector<Suite> suites;
+	return suites;
+}
+
+struct Registration {
+	Registration(const char* const name, void (*run)(const Options&)) { Registry().push_back({name, run}); }
+};
+
+#define BENCHMARK_SUITE(name)                                                  \
+	static void name##_suite(const benchmark::Options&);                      \
+	static const benchmark::Registration name##_registration{#name, name##_suite}; \
+	static void name##_suite([[maybe_unused]] const benchmark::Options& options)
+
+// prevents the optimizer from discarding a computed value
+template <typename T>
+void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "r,m"(value) : "memory");
+#else
+	static volatile const T* sink;
+	sink = &value;
+#endif
+}
+
+template <typename T = std::uint64_t>
+std::vector<T> RandomKeys(const std::int64_t n, const std::uint64_t seed = 42) {
+	std::mt19937_64 engine{seed};
+	std::vector<T> keys(static_cast<std::size_t>(n));
+	for (auto& key : keys) key = static_cast<T>(engine());
+	return keys;
+}
+
+template <typename T = std::uint64_t>
+std::vector<T> AscendingKeys(const std::int64_t n) {
+	std::vector<T> keys(static_cast<std::size_t>(n));
+	std::iota(keys.begin(), keys.end(), T{0});
+	return keys;
+}
+
+template <typename T = std::uint64_t>
+std::vector<T> DescendingKeys(const std::int64_t n) {
+	auto keys = AscendingKeys<T>(n);
+	std::reverse(keys.begin(), keys.end());
+	return keys;
+}
+
+// alternates between the smallest and largest remaining keys, which defeats history based branch prediction
+// in heaps that favor one side of the tree
+template <typename T = std::uint64_t>
+std::vector<T> ZigzagKeys(const std::int64_t n) {
+	std::vector<T> keys;
+	keys.reserve(static_cast<std::size_t>(n));
+	for (std::int64_t low = 0, high = n - 1; low <= high; ++low, --high) {
+		keys.push_back(static_cast<T>(low));
+		if (low != high) keys.push_back(static_cast<T>(high));
+	}
+	return keys;
+}
+
+// a key that counts how often keys of its type are compared
+template <typename T>
+struct Counted {
+	inline static std::int64_t comparisons = 0;
+
+	T value;
+
+	bool operator<(const Counted& other) const {
+		++comparisons;
+		return value < other.value;
+	}
+
+	bool operator>(const Counted& other) const {
+		++comparisons;
+		return other.value < value;
+	}
+};
+
+// keys that share a long common prefix, so comparing them costs more than a few instructions
+inline std::vector<std::string> RandomStrings(const std::int64_t n, const std::uint64_t seed = 42) {
+	std::mt19937_64 engine{seed};
+	std::vector<std::string> keys(static_cast<std::size_t>(n));
+	for (auto& key : keys) key = "customer/region/account/" + std::to_string(engine());
+	return keys;
+}
+
+struct Result {
+	double ns_per_op;
+	double events_per_op;
+};
+
+template <typename Operation>
+Result Measure(const std::int64_t operations, const PerfCounter& counter, Operation&& operation) {
+	counter.Start();
+	const auto start = std::chrono::steady_clock::now();
+	operation();
+	const auto stop = std::chrono::steady_clock::now();
+	const auto events = counter.Stop();
+	const auto ns = std::chrono::duration<double, std::nano>(stop - start).count();
+	return {ns / static_cast<double>(operations), events < 0 ? -1.0 : static_cast<double>(events) / operations};
+}
+
+inline void Report(const char* const suite, const std::string& name, const std::int64_t n, const Result& result,
+	const PerfCounter& counter = PerfCounter::None()) {
+	std::printf("%-16s %-40s n=%-12lld %10.2f ns/op", suite, name.c_str(), static_cast<long long>(n), result.ns_per_op);
+	if (*counter.Name() != '\0') {
+		if (result.events_per_op < 0) {
+			std::printf("  %s/op=n/a", counter.Name());
+		} else {
+			std::printf("  %s/op=%.3f", counter.Name(), result.events_per_op);
+		}
+	}
+	std::printf("\n");
+	std::fflush(stdout);
+}
+
+inline void Report(const char* const suite, const std::string& name, const std::int64_t n, const Result& result,
+	const char* const metric, const double value) {
+	std::printf("%-16s %-40s n=%-12lld %10.2f ns/op  %s=%.3f\n", suite, name.c_str(), static_cast<long long>(n),
+		result.ns_per_op, metric, value);
+	std::fflush(stdout);
+}
+}
@@ -0,0 +1,37 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+
+// usage: min_max_heap_benchmark [suite...] [--sizes=n1,n2,...]
+int main(const int argc, char* argv[]) {
+	benchmark::Options options;
+	std::vector<std::string> filters;
+
+	for (auto i = 1; i < argc; ++i) {
+		if (std::strncmp(argv[i], "--sizes=", 8) == 0) {
+			for (auto* size = argv[i] + 8; *size != '\0';) {
+				char* end;
+				const auto value = std::strtoll(size, &end, 10);
+				if (end == size || (*end != ',' && *end != '\0') || value <= 0) {
+					std::fprintf(stderr, "invalid size list: %s\n", argv[i]);
+					return EXIT_FAILURE;
+				}
+				options.sizes.push_back(value);
+				size = *end == ',' ? end + 1 : end;
+			}
+		} else {
+			filters.emplace_back(argv[i]);
+		}
+	}
+
+	for (const auto& suite : benchmark::Registry()) {
+		if (filters.empty() || std::find(filters.cbegin(), filters.cend(), suite.name) != filters.cend()) {
+			suite.run(options);
+		}
+	}
+}
@@ -0,0 +1,60 @@
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "min_max_heap.hpp"
+
+namespace {
+
+// same ordering as std::uint64_t but not arithmetic, so the heap takes the branching path
+struct BranchingKey {
+	std::uint64_t value;
+	bool operator<(const BranchingKey& other) const noexcept { return value < other.value; }
+	bool operator>(const BranchingKey& other) const noexcept { return value > other.value; }
+};
+
+template <typename Key>
+void Run(const char* const variant, const char* const input, const std::vector<std::uint64_t>& keys) {
+	const auto n = static_cast<std::int64_t>(keys.size());
+	std::vector<Key> values;
+	values.reserve(keys.size());
+	for (const auto key : keys) values.push_back(Key{key});
+
+	const auto counter = benchmark::PerfCounter::BranchMisses();
+	const auto name = std::string{variant} + "/" + input;
+
+	MinMaxHeap<Key> heap;
+	auto result = benchmark::Measure(n, counter, [&] {
+		for (const auto& value : values) heap.Add(value);
+	});
+	benchmark::Report("branchless", name + "/add", n, result, counter);
+
+	result = benchmark::Measure(n, counter, [&] {
+		while (heap.Size() > 0) benchmark::DoNotOptimize(heap.RemoveMin());
+	});
+	benchmark::Report("branchless", name + "/remove_min", n, result, counter);
+
+	MinMaxHeap<Key> other{values.cbegin(), values.cend()};
+	result = benchmark::Measure(n, counter, [&] {
+		while (other.Size() > 0) benchmark::DoNotOptimize(other.RemoveMax());
+	});
+	benchmark::Report("branchless", name + "/remove_max", n, result, counter);
+}
+}
+
+BENCHMARK_SUITE(branchless) {
+	for (const auto n : options.SizesOr({1'000, 1'000'000})) {
+		const std::pair<const char*, std::vector<std::uint64_t>> inputs[] = {
+			{"random", benchmark::RandomKeys(n)},
+			{"ascending", benchmark::AscendingKeys(n)},
+			{"descending", benchmark::DescendingKeys(n)},
+			{"zigzag", benchmark::ZigzagKeys(n)}};
+
+		for (const auto& [input, keys] : inputs) {
+			Run<std::uint64_t>("branchless", input, keys);
+			Run<BranchingKey>("branching", input, keys);
+		}
+	}
+}
@@ -0,0 +1,40 @@
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "bucket_depq.hpp"
+#include "min_max_heap.hpp"
+
+namespace {
+
+// a queue of n keys drawn from [0, range) that alternates adding a key with removing one end or the other,
+// reporting the cost per operation
+template <typename Queue>
+void Run(const std::string& name, Queue&& queue, const std::int64_t n, const std::int32_t range) {
+	constexpr std::int64_t kOperations = 4'000'000;
+	std::mt19937 engine{127};
+	std::uniform_int_distribution<std::int32_t> distribution{0, range - 1};
+	std::vector<std::int32_t> keys(static_cast<std::size_t>(n + kOperations));
+	for (auto& key : keys) key = distribution(engine);
+
+	for (std::int64_t i = 0; i < n; ++i) queue.Add(keys[i]);
+	const auto result = benchmark::Measure(2 * kOperations, benchmark::PerfCounter::None(), [&] {
+		for (auto i = n; i < n + kOperations; ++i) {
+			queue.Add(keys[i]);
+			benchmark::DoNotOptimize(i % 2 == 0 ? queue.RemoveMin() : queue.RemoveMax());
+		}
+	});
+	benchmark::Report("bucket", name + "/range=" + std::to_string(range), n, result);
+}
+}
+
+BENCHMARK_SUITE(bucket) {
+	for (const auto n : options.SizesOr({1'000'000})) {
+		for (const auto range : {256, 4'096, 65'536, 1'048'576}) {
+			Run("min_max_heap", MinMaxHeap<std::int32_t>{}, n, range);
+			Run("bucket_depq", BucketDEPQ<std::int32_t>{0, range - 1}, n, range);
+		}
+	}
+}
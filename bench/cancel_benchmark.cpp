@@ -0,0 +1,91 @@
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "tombstone_min_max_heap.hpp"
+
+namespace {
+
+// Order book churn: every step places an order, 70% of orders are cancelled a fixed number of steps later unless
+// they were executed first, and every third step executes the lowest or the highest order. Keys carry the order
+// id in their low 32 bits, so an executed key identifies its order.
+constexpr auto kCancelDelay = 1'000;
+
+std::vector<std::uint64_t> Orders(const std::int64_t steps) {
+	auto keys = benchmark::RandomKeys(steps);
+	for (std::int64_t id = 0; id < steps; ++id) keys[id] = (keys[id] & ~std::uint64_t{0xFFFF'FFFF}) | id;
+	return keys;
+}
+
+template <typename Book, typename Cancel>
+void Churn(const std::vector<std::uint64_t>& orders, Book& book, Cancel&& cancel) {
+	std::mt19937 engine{101};
+	std::vector<bool> executed(orders.size());
+	std::deque<std::uint32_t> pending;
+
+	for (std::uint32_t id = 0; id < orders.size(); ++id) {
+		book.Place(id, orders[id]);
+		if (engine() % 10 < 7) pending.push_back(id);
+		if (pending.size() > kCancelDelay) {
+			if (!executed[pending.front()]) cancel(pending.front());
+			pending.pop_front();
+		}
+		if (id % 3 == 2 && book.Size() > 0) {
+			const auto key = id % 2 == 0 ? book.ExecuteLowest() : book.ExecuteHighest();
+			executed[key & 0xFFFF'FFFF] = true;
+		}
+	}
+}
+
+void RunTombstones(const double max_dead_fraction, const std::vector<std::uint64_t>& orders) {
+	struct Book {
+		void Place(const std::uint32_t id, const std::uint64_t key) { handles[id] = heap.Add(key); }
+		std::uint64_t ExecuteLowest() { return heap.RemoveMin(); }
+		std::uint64_t ExecuteHighest() { return heap.RemoveMax(); }
+		[[nodiscard]] auto Size() const { return heap.Size(); }
+
+		TombstoneMinMaxHeap<std::uint64_t> heap;
+		std::vector<TombstoneMinMaxHeap<std::uint64_t>::Handle> handles;
+	} book;
+	book.heap = TombstoneMinMaxHeap<std::uint64_t>{std::less<std::uint64_t>{}, max_dead_fraction};
+	book.handles.resize(orders.size());
+
+	const auto n = static_cast<std::int64_t>(orders.size());
+	const auto result = benchmark::Measure(n, benchmark::PerfCounter::None(), [&] {
+		Churn(orders, book, [&](const std::uint32_t id) { book.heap.MarkDeleted(book.handles[id]); });
+	});
+	benchmark::Report("cancel", "tombstones/max_dead=" + std::to_string(max_dead_fraction).substr(0, 4), n, result);
+}
+
+void RunMultiset(const std::vector<std::uint64_t>& orders) {
+	struct Book {
+		void Place(const std::uint32_t id, const std::uint64_t key) { positions[id] = set.insert(key); }
+		std::uint64_t ExecuteLowest() { return set.extract(set.begin()).value(); }
+		std::uint64_t ExecuteHighest() { return set.extract(std::prev(set.end())).value(); }
+		[[nodiscard]] auto Size() const { return set.size(); }
+
+		std::multiset<std::uint64_t> set;
+		std::vector<std::multiset<std::uint64_t>::iterator> positions;
+	} book;
+	book.positions.resize(orders.size());
+
+	const auto n = static_cast<std::int64_t>(orders.size());
+	const auto result = benchmark::Measure(n, benchmark::PerfCounter::None(), [&] {
+		Churn(orders, book, [&](const std::uint32_t id) { book.set.erase(book.positions[id]); });
+	});
+	benchmark::Report("cancel", "multiset", n, result);
+}
+}
+
+BENCHMARK_SUITE(cancel) {
+	for (const auto n : options.SizesOr({4'000'000})) {
+		const auto orders = Orders(n);
+		for (const auto max_dead_fraction : {0.25, 0.5, 0.75}) RunTombstones(max_dead_fraction, orders);
+		RunMultiset(orders);
+	}
+}
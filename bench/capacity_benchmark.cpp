@@ -0,0 +1,55 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "min_max_heap.hpp"
+
+namespace {
+
+template <int ShrinkAfterPops>
+struct ShrinkPolicy : MinMaxHeapPolicy {
+	static constexpr int kShrinkAfterPops = ShrinkAfterPops;
+};
+
+// a queue that idles at a small size and spikes to n elements every few thousand operations, then drains back
+template <typename Policy>
+void Run(const std::string& name, const std::int64_t n) {
+	constexpr auto kCycles = 8;
+	constexpr auto kIdleSize = 1'000;
+	constexpr auto kIdleOperations = 200'000;
+	const auto keys = benchmark::RandomKeys<std::uint32_t>(n);
+
+	MinMaxHeap<std::uint32_t, Policy> heap;
+	auto peak_capacity = std::int64_t{0};
+	auto idle_capacity = std::int64_t{0};
+	auto operations = std::int64_t{0};
+
+	const auto result = benchmark::Measure(1, benchmark::PerfCounter::None(), [&] {
+		for (auto cycle = 0; cycle < kCycles; ++cycle) {
+			for (const auto key : keys) heap.Add(key);
+			peak_capacity = std::max<std::int64_t>(peak_capacity, heap.Capacity());
+			while (heap.Size() > kIdleSize) benchmark::DoNotOptimize(heap.RemoveMax());
+
+			for (auto i = 0; i < kIdleOperations; ++i) {
+				benchmark::DoNotOptimize(heap.RemoveMin());
+				heap.Add(keys[static_cast<std::size_t>(i) % keys.size()]);
+			}
+			idle_capacity += heap.Capacity();
+			operations += 2 * n + 2 * kIdleOperations;
+		}
+	});
+
+	const auto element_bytes = static_cast<double>(sizeof(std::uint32_t));
+	const benchmark::Result per_operation{result.ns_per_op / static_cast<double>(operations), -1};
+	benchmark::Report("capacity", name + "/peak", n, per_operation, "bytes", peak_capacity * element_bytes);
+	benchmark::Report("capacity", name + "/idle", n, per_operation, "bytes", idle_capacity * element_bytes / kCycles);
+}
+}
+
+BENCHMARK_SUITE(capacity) {
+	for (const auto n : options.SizesOr({100'000, 10'000'000})) {
+		Run<MinMaxHeapPolicy>("shrink=never", n);
+		Run<ShrinkPolicy<1'024>>("shrink_after=1024", n);
+	}
+}
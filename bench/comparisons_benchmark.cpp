@@ -0,0 +1,78 @@
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "min_max_heap.hpp"
+
+namespace {
+
+using Key = benchmark::Counted<std::string>;
+
+struct LeafPathPolicy : MinMaxHeapPolicy {
+	static constexpr bool kLeafPathRemoval = true;
+};
+
+struct BinarySearchInsertionPolicy : MinMaxHeapPolicy {
+	static constexpr bool kBinarySearchInsertion = true;
+};
+
+template <typename Policy>
+void RunAdd(const char* const variant, const char* const input, const std::vector<Key>& keys) {
+	const auto n = static_cast<std::int64_t>(keys.size());
+	MinMaxHeap<Key, Policy> heap;
+	Key::comparisons = 0;
+	const auto result = benchmark::Measure(n, benchmark::PerfCounter::None(), [&] {
+		for (const auto& key : keys) heap.Add(key);
+	});
+	benchmark::Report("comparisons", std::string{variant} + "/add/" + input, n, result, "comparisons/op",
+		static_cast<double>(Key::comparisons) / n);
+}
+
+template <typename Policy>
+void RunAdd(const char* const variant, const std::int64_t n) {
+	const auto strings = benchmark::RandomStrings(n);
+	std::vector<Key> keys;
+	keys.reserve(strings.size());
+	for (const auto& string : strings) keys.push_back(Key{string});
+	RunAdd<Policy>(variant, "random", keys);
+
+	// every key is a new minimum and climbs all the way to the root
+	std::sort(keys.begin(), keys.end(), [](const auto& a, const auto& b) { return b.value < a.value; });
+	RunAdd<Policy>(variant, "descending", keys);
+}
+
+template <typename Policy>
+void Run(const char* const variant, const std::int64_t n) {
+	const auto strings = benchmark::RandomStrings(n);
+	std::vector<Key> keys;
+	keys.reserve(strings.size());
+	for (const auto& string : strings) keys.push_back(Key{string});
+
+	MinMaxHeap<Key, Policy> heap{keys.cbegin(), keys.cend()};
+	Key::comparisons = 0;
+	auto result = benchmark::Measure(n, benchmark::PerfCounter::None(), [&] {
+		while (heap.Size() > 0) benchmark::DoNotOptimize(heap.RemoveMin());
+	});
+	benchmark::Report("comparisons", std::string{variant} + "/remove_min", n, result, "comparisons/op",
+		static_cast<double>(Key::comparisons) / n);
+
+	heap = MinMaxHeap<Key, Policy>{keys.cbegin(), keys.cend()};
+	Key::comparisons = 0;
+	result = benchmark::Measure(n, benchmark::PerfCounter::None(), [&] {
+		while (heap.Size() > 0) benchmark::DoNotOptimize(heap.RemoveMax());
+	});
+	benchmark::Report("comparisons", std::string{variant} + "/remove_max", n, result, "comparisons/op",
+		static_cast<double>(Key::comparisons) / n);
+}
+}
+
+BENCHMARK_SUITE(comparisons) {
+	for (const auto n : options.SizesOr({1'000, 100'000, 1'000'000})) {
+		Run<MinMaxHeapPolicy>("sift_down", n);
+		Run<LeafPathPolicy>("leaf_path", n);
+		RunAdd<MinMaxHeapPolicy>("linear_insertion", n);
+		RunAdd<BinarySearchInsertionPolicy>("binary_search_insertion", n);
+	}
+}
@@ -0,0 +1,68 @@
+#include <cstdint>
+#include <string>
+
+#include "benchmark.hpp"
+#include "double_ended_priority_queue.hpp"
+
+namespace {
+
+// each workload starts from a queue of n random keys and performs n operations
+template <typename Backend>
+void Run(const char* const backend, const std::int64_t n) {
+	using Queue = DoubleEndedPriorityQueue<std::uint64_t, Backend>;
+	const auto keys = benchmark::RandomKeys(n);
+	const auto operations = benchmark::RandomKeys(n, 7);
+	const auto name = std::string{backend};
+
+	auto result = benchmark::Measure(n, benchmark::PerfCounter::None(), [&] {
+		const Queue queue{keys.cbegin(), keys.cend()};
+		benchmark::DoNotOptimize(queue.Min());
+	});
+	benchmark::Report("depq", name + "/build", n, result);
+
+	// nine insertions for every removal from either end
+	Queue queue{keys.cbegin(), keys.cend()};
+	result = benchmark::Measure(n, benchmark::PerfCounter::None(), [&] {
+		for (const auto operation : operations) {
+			if (operation % 10 == 0) {
+				benchmark::DoNotOptimize(operation % 20 == 0 ? queue.RemoveMin() : queue.RemoveMax());
+			} else {
+				queue.Add(operation);
+			}
+		}
+	});
+	benchmark::Report("depq", name + "/insert_heavy", n, result);
+
+	// a steady-size queue drained only from its minimum
+	queue = Queue{keys.cbegin(), keys.cend()};
+	result = benchmark::Measure(n, benchmark::PerfCounter::None(), [&] {
+		for (const auto operation : operations) {
+			benchmark::DoNotOptimize(queue.RemoveMin());
+			queue.Add(operation);
+		}
+	});
+	benchmark::Report("depq", name + "/pop_min_heavy", n, result);
+
+	// a steady-size queue drained from both ends alike
+	queue = Queue{keys.cbegin(), keys.cend()};
+	result = benchmark::Measure(n, benchmark::PerfCounter::None(), [&] {
+		for (const auto operation : operations) {
+			benchmark::DoNotOptimize(operation % 2 == 0 ? queue.RemoveMin() : queue.RemoveMax());
+			queue.Add(operation);
+		}
+	});
+	benchmark::Report("depq", name + "/balanced", n, result);
+}
+}
+
+BENCHMARK_SUITE(depq) {
+	for (const auto n : options.SizesOr({1'000, 100'000, 1'000'000})) {
+		Run<MinMaxHeapBackend>("min_max_heap", n);
+		Run<IntervalHeapBackend>("interval_heap", n);
+		Run<SymmetricMinMaxHeapBackend>("symmetric_min_max_heap", n);
+		Run<DeapBackend>("deap", n);
+		Run<TwinHeapBackend>("twin_heap", n);
+		Run<MeldableMinMaxHeapBackend>("meldable_min_max_heap", n);
+		Run<BufferedMinMaxHeapBackend>("buffered_min_max_heap", n);
+	}
+}
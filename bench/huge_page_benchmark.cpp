@@ -0,0 +1,42 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "huge_page_allocator.hpp"
+#include "min_max_heap.hpp"
+
+namespace {
+
+struct HugePagePolicy : MinMaxHeapPolicy {
+	template <typename U>
+	using Storage = HugePageStorage<U>;
+};
+
+template <typename Policy>
+void Run(const char* const storage_name, const std::vector<std::uint64_t>& keys,
+	const std::vector<std::uint64_t>& refills) {
+
+	const auto n = static_cast<std::int64_t>(keys.size());
+	const auto operations = static_cast<std::int64_t>(refills.size());
+	MinMaxHeap<std::uint64_t, Policy> heap{keys.cbegin(), keys.cend()};
+
+	const auto counter = benchmark::PerfCounter::DtlbMisses();
+	const auto result = benchmark::Measure(operations, counter, [&] {
+		for (const auto refill : refills) {
+			benchmark::DoNotOptimize(refill % 2 == 0 ? heap.RemoveMin() : heap.RemoveMax());
+			heap.Add(refill);
+		}
+	});
+	benchmark::Report("hugepage", std::string{"storage="} + storage_name + "/remove+add", n, result, counter);
+}
+}
+
+BENCHMARK_SUITE(hugepage) {
+	for (const auto n : options.SizesOr({1'000'000, 16'000'000, 64'000'000})) {
+		const auto keys = benchmark::RandomKeys(n);
+		const auto refills = benchmark::RandomKeys(std::min<std::int64_t>(n, 4'000'000), 7);
+		Run<MinMaxHeapPolicy>("vector", keys, refills);
+		Run<HugePagePolicy>("huge_pages", keys, refills);
+	}
+}
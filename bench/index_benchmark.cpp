@@ -0,0 +1,56 @@
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "min_max_heap.hpp"
+
+namespace {
+
+template <typename Index>
+struct IndexTypePolicy : MinMaxHeapPolicy {
+	using IndexType = Index;
+};
+
+template <typename Index>
+void Run(const char* const index_name, const std::int64_t n) {
+	if (static_cast<std::uint64_t>(n) >= static_cast<std::uint64_t>(std::numeric_limits<Index>::max())) return;
+
+	const auto name = std::string{"index="} + index_name;
+	const auto operations = std::min<std::int64_t>(n, 10'000'000);
+	const auto refills = benchmark::RandomKeys<std::uint32_t>(operations, 7);
+
+	// the keys are released right after the build so that only the heap itself stays resident
+	auto keys = benchmark::RandomKeys<std::uint32_t>(n);
+	auto result = benchmark::Measure(n, benchmark::PerfCounter::None(), [&] {
+		MinMaxHeap<std::uint32_t, IndexTypePolicy<Index>> heap{keys.cbegin(), keys.cend()};
+		benchmark::DoNotOptimize(heap.Min());
+	});
+	benchmark::Report("index", name + "/build", n, result);
+
+	MinMaxHeap<std::uint32_t, IndexTypePolicy<Index>> heap{keys.cbegin(), keys.cend()};
+	keys = {};
+
+	const auto counter = benchmark::PerfCounter::DtlbMisses();
+	result = benchmark::Measure(operations, counter, [&] {
+		for (const auto refill : refills) {
+			benchmark::DoNotOptimize(heap.RemoveMin());
+			heap.Add(refill);
+			benchmark::DoNotOptimize(heap.RemoveMax());
+			heap.Add(refill);
+		}
+	});
+	benchmark::Report("index", name + "/remove+add", n, result, counter);
+}
+}
+
+// pass --sizes=4000000000 on a machine with at least 32 GB of memory to run past the range of a 32-bit int
+BENCHMARK_SUITE(index) {
+	for (const auto n : options.SizesOr({1'000'000, 64'000'000})) {
+		Run<int>("int", n);
+		Run<std::uint32_t>("uint32", n);
+		Run<std::size_t>("size_t", n);
+	}
+}
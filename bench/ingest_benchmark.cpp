@@ -0,0 +1,45 @@
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "buffered_min_max_heap.hpp"
+#include "min_max_heap.hpp"
+
+namespace {
+
+// starts from a heap of n keys and repeats ratio additions followed by one removal, alternating between the two
+// ends, reporting the cost per operation
+template <typename Heap>
+void Run(const std::string& name, const std::vector<std::uint64_t>& keys, const std::int64_t n,
+	const std::int64_t ratio) {
+	const auto adds = static_cast<std::int64_t>(keys.size()) - n;
+	Heap heap{keys.cbegin(), keys.cbegin() + n};
+
+	const auto result = benchmark::Measure(adds + adds / ratio, benchmark::PerfCounter::None(), [&] {
+		for (auto i = n; i < n + adds;) {
+			for (const auto end = i + ratio; i < end; ++i) heap.Add(keys[i]);
+			benchmark::DoNotOptimize(i / ratio % 2 == 0 ? heap.RemoveMin() : heap.RemoveMax());
+		}
+	});
+	benchmark::Report("ingest", name + "/" + std::to_string(ratio) + ":1", n, result);
+}
+}
+
+BENCHMARK_SUITE(ingest) {
+	constexpr std::int64_t kAdds = 4'000'000;
+	for (const auto n : options.SizesOr({1'000'000})) {
+		// random keys land near the leaves, while ascending keys, such as timestamps, climb to the top of the heap
+		for (const auto& [order, keys] :
+			{std::pair{"random", benchmark::RandomKeys(n + kAdds)}, {"ascending", benchmark::AscendingKeys(n + kAdds)}}) {
+			for (const auto ratio : {1, 10, 100}) {
+				const auto suffix = std::string{"/"} + order;
+				Run<MinMaxHeap<std::uint64_t>>("min_max_heap" + suffix, keys, n, ratio);
+				Run<BufferedMinMaxHeap<std::uint64_t, 16>>("buffered<16>" + suffix, keys, n, ratio);
+				Run<BufferedMinMaxHeap<std::uint64_t, 64>>("buffered<64>" + suffix, keys, n, ratio);
+				Run<BufferedMinMaxHeap<std::uint64_t, 256>>("buffered<256>" + suffix, keys, n, ratio);
+			}
+		}
+	}
+}
@@ -0,0 +1,47 @@
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+#include "benchmark.hpp"
+#include "blocked_storage.hpp"
+#include "min_max_heap.hpp"
+
+namespace {
+
+struct BlockedPolicy : MinMaxHeapPolicy {
+	template <typename U>
+	using Storage = CacheLineBlockedStorage<U>;
+};
+
+template <typename Policy>
+void Run(const char* const variant, const std::int64_t n) {
+	const auto keys = benchmark::RandomKeys(n);
+	const auto refills = benchmark::RandomKeys(std::min<std::int64_t>(n, 1'000'000), 7);
+	const auto operations = static_cast<std::int64_t>(refills.size());
+	const auto counter = benchmark::PerfCounter::CacheMisses();
+
+	MinMaxHeap<std::uint64_t, Policy> heap{keys.cbegin(), keys.cend()};
+	auto result = benchmark::Measure(operations, counter, [&] {
+		for (const auto refill : refills) {
+			benchmark::DoNotOptimize(heap.RemoveMin());
+			heap.Add(refill);
+		}
+	});
+	benchmark::Report("layout", std::string{variant} + "/remove_min+add", n, result, counter);
+
+	result = benchmark::Measure(operations, counter, [&] {
+		for (const auto refill : refills) {
+			benchmark::DoNotOptimize(heap.RemoveMax());
+			heap.Add(refill);
+		}
+	});
+	benchmark::Report("layout", std::string{variant} + "/remove_max+add", n, result, counter);
+}
+}
+
+BENCHMARK_SUITE(layout) {
+	for (const auto n : options.SizesOr({1'000'000, 16'000'000, 64'000'000})) {
+		Run<MinMaxHeapPolicy>("flat", n);
+		Run<BlockedPolicy>("blocked", n);
+	}
+}
@@ -0,0 +1,60 @@
+#include <cstdint>
+#include <string>
+
+#include "benchmark.hpp"
+#include "min_max_heap.hpp"
+
+namespace {
+
+struct LazyPolicy : MinMaxHeapPolicy {
+	static constexpr bool kLazyHeapify = true;
+};
+
+// builds a heap of n keys, appends a burst of adds and then queries it, reporting the cost per element
+template <typename Policy>
+void RunStartup(const char* const name, const std::int64_t n, const std::int64_t adds) {
+	const auto keys = benchmark::RandomKeys(n + adds);
+
+	const auto result = benchmark::Measure(n + adds, benchmark::PerfCounter::None(), [&] {
+		MinMaxHeap<std::uint64_t, Policy> heap{keys.cbegin(), keys.cbegin() + n};
+		for (auto i = n; i < n + adds; ++i) heap.Add(keys[i]);
+		benchmark::DoNotOptimize(heap.Max());
+	});
+	benchmark::Report("lazy", std::string{name} + "/startup/adds=" + std::to_string(adds), n, result);
+}
+
+// alternates bursts of adds with a few removals at both ends, reporting the cost per add
+template <typename Policy>
+void RunBursts(const char* const name, const std::int64_t n, const std::int64_t burst) {
+	constexpr auto kRounds = 64;
+	const auto keys = benchmark::RandomKeys(n + burst * kRounds);
+	MinMaxHeap<std::uint64_t, Policy> heap{keys.cbegin(), keys.cbegin() + n};
+	heap.Reserve(n + burst * kRounds);
+	// the lazy heap builds itself on its first query, which belongs to startup rather than to the bursts
+	benchmark::DoNotOptimize(heap.Max());
+
+	const auto result = benchmark::Measure(burst * kRounds, benchmark::PerfCounter::None(), [&] {
+		for (auto round = 0; round < kRounds; ++round) {
+			for (auto i = n + burst * round; i < n + burst * (round + 1); ++i) heap.Add(keys[i]);
+			for (auto i = 0; i < 8; ++i) {
+				benchmark::DoNotOptimize(heap.RemoveMin());
+				benchmark::DoNotOptimize(heap.RemoveMax());
+			}
+		}
+	});
+	benchmark::Report("lazy", std::string{name} + "/bursts/burst=" + std::to_string(burst), n, result);
+}
+}
+
+BENCHMARK_SUITE(lazy) {
+	for (const auto n : options.SizesOr({1'000'000})) {
+		for (const auto adds : {std::int64_t{0}, n / 100, n / 10, n}) {
+			RunStartup<MinMaxHeapPolicy>("eager", n, adds);
+			RunStartup<LazyPolicy>("lazy", n, adds);
+		}
+		for (const auto burst : {std::int64_t{16}, std::int64_t{1'000}, n / 10}) {
+			RunBursts<LazyPolicy>("lazy", n, burst);
+			RunBursts<MinMaxHeapPolicy>("eager", n, burst);
+		}
+	}
+}
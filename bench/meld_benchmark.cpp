@@ -0,0 +1,81 @@
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "meldable_min_max_heap.hpp"
+#include "min_max_heap.hpp"
+
+namespace {
+
+// MinMaxHeap has no meld, so merging drains the source into the target
+void Merge(MinMaxHeap<std::uint64_t>& target, MinMaxHeap<std::uint64_t>& source) {
+	while (source.Size() > 0) target.Add(source.RemoveMax());
+}
+
+void Merge(MeldableMinMaxHeap<std::uint64_t>& target, MeldableMinMaxHeap<std::uint64_t>& source) {
+	target.Meld(std::move(source));
+}
+
+// an aggregation trace over a fixed set of heaps: every step merges one random heap into another, refills the
+// emptied heap with a few fresh keys and trims the merged heap from both ends
+template <typename Heap>
+void Run(const char* const variant, const std::int64_t heap_count, const std::int64_t steps) {
+	const auto keys = benchmark::RandomKeys(heap_count * 16 + steps * 4);
+	auto key = keys.cbegin();
+
+	std::vector<Heap> heaps(static_cast<std::size_t>(heap_count));
+	for (auto& heap : heaps) {
+		for (auto i = 0; i < 16; ++i) heap.Add(*key++);
+	}
+
+	std::mt19937_64 engine{3};
+	const auto result = benchmark::Measure(steps, benchmark::PerfCounter::None(), [&] {
+		for (std::int64_t step = 0; step < steps; ++step) {
+			auto& target = heaps[engine() % heaps.size()];
+			auto& source = heaps[engine() % heaps.size()];
+			if (&target == &source) continue;
+
+			Merge(target, source);
+			for (auto i = 0; i < 4; ++i) source.Add(*key++);
+			if (target.Size() > 2) {
+				benchmark::DoNotOptimize(target.RemoveMin());
+				benchmark::DoNotOptimize(target.RemoveMax());
+			}
+		}
+	});
+	benchmark::Report("meld", std::string{variant} + "/heaps=" + std::to_string(heap_count), steps, result);
+}
+
+// melds many small heaps one after another into a single accumulator, whose node pool keeps every chunk it took in
+template <typename Heap>
+void RunChain(const char* const variant, const std::int64_t heap_count) {
+	const auto keys = benchmark::RandomKeys(heap_count * 16);
+	auto key = keys.cbegin();
+
+	std::vector<Heap> heaps(static_cast<std::size_t>(heap_count));
+	for (auto& heap : heaps) {
+		for (auto i = 0; i < 16; ++i) heap.Add(*key++);
+	}
+
+	Heap accumulator;
+	const auto result = benchmark::Measure(heap_count, benchmark::PerfCounter::None(), [&] {
+		for (auto& heap : heaps) Merge(accumulator, heap);
+	});
+	benchmark::DoNotOptimize(accumulator.Max());
+	benchmark::Report("meld", std::string{variant} + "/chain=" + std::to_string(heap_count), heap_count, result);
+}
+}
+
+BENCHMARK_SUITE(meld) {
+	for (const auto heap_count : options.SizesOr({100, 1'000, 10'000})) {
+		Run<MinMaxHeap<std::uint64_t>>("min_max_heap", heap_count, 200'000);
+		Run<MeldableMinMaxHeap<std::uint64_t>>("meldable_min_max_heap", heap_count, 200'000);
+	}
+	for (const auto heap_count : {10'000, 40'000, 80'000}) {
+		RunChain<MinMaxHeap<std::uint64_t>>("min_max_heap", heap_count);
+		RunChain<MeldableMinMaxHeap<std::uint64_t>>("meldable_min_max_heap", heap_count);
+	}
+}
@@ -0,0 +1,40 @@
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "benchmark.hpp"
+#include "min_max_heap.hpp"
+
+namespace {
+
+template <int Threads>
+struct ThreadedPolicy : MinMaxHeapPolicy {
+	static constexpr int kBuildThreads = Threads;
+};
+
+// reports the time from handing over a buffer of random keys to the first query, in total and per element
+template <int Threads>
+void Run(const std::int64_t n) {
+	// 32-bit keys keep a billion of them within 4 GiB, and regenerating them per run avoids holding a second copy
+	auto keys = benchmark::RandomKeys<std::uint32_t>(n);
+
+	const auto result = benchmark::Measure(n, benchmark::PerfCounter::None(), [&] {
+		MinMaxHeap<std::uint32_t, ThreadedPolicy<Threads>> heap{std::move(keys)};
+		benchmark::DoNotOptimize(heap.Max());
+	});
+	benchmark::Report("parallel", "threads=" + std::to_string(Threads), n, result, "startup_ms",
+		result.ns_per_op * static_cast<double>(n) / 1e6);
+}
+}
+
+BENCHMARK_SUITE(parallel) {
+	for (const auto n : options.SizesOr({100'000'000, 1'000'000'000})) {
+		Run<1>(n);
+		Run<2>(n);
+		Run<4>(n);
+		Run<8>(n);
+		Run<16>(n);
+		Run<32>(n);
+		Run<64>(n);
+	}
+}
@@ -0,0 +1,43 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "min_max_heap.hpp"
+
+namespace {
+
+using Key = benchmark::Counted<std::string>;
+
+// admission control for a bounded queue that keeps the k smallest keys: every arrival polls the current maximum
+// several times before deciding whether to evict it
+void Run(const std::int64_t k, const std::int64_t arrivals) {
+	const auto strings = benchmark::RandomStrings(arrivals);
+	std::vector<Key> keys;
+	keys.reserve(strings.size());
+	for (const auto& string : strings) keys.push_back(Key{string});
+
+	MinMaxHeap<Key> heap;
+	Key::comparisons = 0;
+	const auto result = benchmark::Measure(arrivals, benchmark::PerfCounter::None(), [&] {
+		for (const auto& key : keys) {
+			for (auto poll = 0; poll < 8; ++poll) benchmark::DoNotOptimize(heap.Size() > 0 ? &heap.Max() : nullptr);
+
+			if (heap.Size() < k) {
+				heap.Add(key);
+			} else if (key < heap.Max()) {
+				benchmark::DoNotOptimize(heap.RemoveMax());
+				heap.Add(key);
+			}
+		}
+	});
+	benchmark::Report("polling", "bounded_k=" + std::to_string(k), arrivals, result, "comparisons/op",
+		static_cast<double>(Key::comparisons) / arrivals);
+}
+}
+
+BENCHMARK_SUITE(polling) {
+	for (const auto k : options.SizesOr({16, 1'024, 65'536})) {
+		Run(k, 1'000'000);
+	}
+}
@@ -0,0 +1,60 @@
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "min_max_heap.hpp"
+#include "run_length_min_max_heap.hpp"
+
+namespace {
+
+// n entries whose keys are drawn from a few thousand price ticks
+std::vector<std::int32_t> Ticks(const std::int64_t n, const std::int64_t distinct) {
+	const auto keys = benchmark::RandomKeys(n);
+	std::vector<std::int32_t> ticks(keys.size());
+	for (std::size_t i = 0; i < keys.size(); ++i) ticks[i] = static_cast<std::int32_t>(keys[i] % distinct);
+	return ticks;
+}
+
+// adds every entry, then alternates removals at both ends with re-adding the removed keys, then drains; reports
+// the time per operation and the bytes that the queue stores per entry
+template <typename Heap, typename Bytes>
+void Run(const std::string& name, const std::vector<std::int32_t>& ticks, const std::int64_t distinct,
+	Bytes&& bytes) {
+	const auto n = static_cast<std::int64_t>(ticks.size());
+	auto stored_bytes = 0.0;
+
+	const auto result = benchmark::Measure(4 * n, benchmark::PerfCounter::None(), [&] {
+		Heap heap;
+		for (const auto tick : ticks) heap.Add(tick);
+		stored_bytes = bytes(heap);
+
+		for (std::int64_t i = 0; i < n / 2; ++i) {
+			heap.Add(i % 2 == 0 ? heap.RemoveMin() : heap.RemoveMax());
+		}
+		while (heap.Size() > 0) benchmark::DoNotOptimize(heap.RemoveMin());
+	});
+	benchmark::Report("runlength", name + "/distinct=" + std::to_string(distinct), n, result, "bytes_per_entry",
+		stored_bytes / static_cast<double>(n));
+}
+}
+
+BENCHMARK_SUITE(runlength) {
+	for (const auto n : options.SizesOr({10'000'000})) {
+		for (const auto distinct : {std::int64_t{1'000}, std::int64_t{4'096}, std::int64_t{100'000}}) {
+			const auto ticks = Ticks(n, distinct);
+			Run<MinMaxHeap<std::int32_t>>("min_max_heap", ticks, distinct,
+				[](const auto& heap) { return static_cast<double>(heap.Capacity() * sizeof(std::int32_t)); });
+
+			// the heap holds each distinct key once, and each hash index node holds a key, a count, a link and
+			// the cached hash, plus a bucket pointer per node at the default maximum load factor
+			Run<RunLengthMinMaxHeap<std::int32_t>>("run_length", ticks, distinct, [](const auto& heap) {
+				using Node = std::pair<std::int32_t, std::uint64_t>;
+				const auto per_key = sizeof(std::int32_t) + sizeof(Node) + 3 * sizeof(void*);
+				return static_cast<double>(heap.DistinctSize() * per_key);
+			});
+		}
+	}
+}
@@ -0,0 +1,47 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "min_max_heap.hpp"
+
+namespace {
+
+template <int Threshold>
+struct SmallSizePolicy : MinMaxHeapPolicy {
+	static constexpr int kSmallSizeThreshold = Threshold;
+};
+
+// many short-lived heaps of the same size: fill one, then drain it alternating between both ends
+template <typename Key, int Threshold>
+void Run(const char* const key_name, const std::vector<Key>& keys, const std::int64_t n) {
+	const auto heaps = static_cast<std::int64_t>(keys.size()) / n;
+	const auto result = benchmark::Measure(heaps * n * 2, benchmark::PerfCounter::None(), [&] {
+		for (auto h = std::int64_t{0}; h < heaps; ++h) {
+			MinMaxHeap<Key, SmallSizePolicy<Threshold>> heap;
+			for (auto i = h * n; i < (h + 1) * n; ++i) heap.Add(keys[i]);
+			while (heap.Size() > 0) {
+				benchmark::DoNotOptimize(heap.Size() % 2 == 0 ? heap.RemoveMin() : heap.RemoveMax());
+			}
+		}
+	});
+	benchmark::Report("small", std::string{key_name} + "/threshold=" + std::to_string(Threshold), n, result);
+}
+
+template <typename Key>
+void RunThresholds(const char* const key_name, const std::vector<Key>& keys, const std::int64_t n) {
+	Run<Key, 0>(key_name, keys, n);
+	Run<Key, MinMaxHeapPolicy::kSmallSizeThreshold>(key_name, keys, n);
+	Run<Key, 64>(key_name, keys, n);
+}
+}
+
+BENCHMARK_SUITE(small) {
+	const auto integers = benchmark::RandomKeys<std::uint32_t>(1 << 20);
+	const auto strings = benchmark::RandomStrings(1 << 18);
+
+	for (const auto n : options.SizesOr({1, 2, 4, 8, 12, 16, 24, 32, 48, 64})) {
+		RunThresholds("uint32", integers, n);
+		RunThresholds("string", strings, n);
+	}
+}
@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "min_max_heap_algorithm.hpp"
+
+namespace {
+
+template <typename Sort>
+void Run(const std::string& name, const std::vector<std::uint64_t>& keys, std::vector<std::uint64_t>& buffer,
+	Sort&& sort) {
+
+	buffer = keys;
+	const auto n = static_cast<std::int64_t>(keys.size());
+	const auto result = benchmark::Measure(n, benchmark::PerfCounter::None(), [&] {
+		sort(buffer.begin(), buffer.end());
+		benchmark::DoNotOptimize(buffer.data());
+	});
+	benchmark::Report("sort", name, n, result);
+}
+
+// trims the given fraction of outliers from each end of the keys
+void RunTrim(const std::vector<std::uint64_t>& keys, std::vector<std::uint64_t>& buffer, const double fraction) {
+	using Iterator = std::vector<std::uint64_t>::iterator;
+	const auto k = static_cast<std::ptrdiff_t>(static_cast<double>(keys.size()) * fraction);
+	const auto suffix = "/trim=" + std::to_string(k);
+
+	Run("std::partial_sort_x2" + suffix, keys, buffer, [k](const Iterator first, const Iterator last) {
+		std::partial_sort(first, first + k, last);
+		const auto reversed_last = std::make_reverse_iterator(first + k);
+		std::partial_sort(std::make_reverse_iterator(last), std::make_reverse_iterator(last - k), reversed_last,
+			std::greater<>{});
+	});
+	Run("std::nth_element_x2+sort" + suffix, keys, buffer, [k](const Iterator first, const Iterator last) {
+		std::nth_element(first, first + k, last);
+		std::sort(first, first + k);
+		std::nth_element(first + k, last - k, last);
+		std::sort(last - k, last);
+	});
+	Run("minmax_partial_sort_both_ends" + suffix, keys, buffer, [k](const Iterator first, const Iterator last) {
+		minmax_partial_sort_both_ends(first, last, k, k);
+	});
+}
+}
+
+BENCHMARK_SUITE(sort) {
+	for (const auto n : options.SizesOr({1'000'000, 100'000'000})) {
+		const auto keys = benchmark::RandomKeys(n);
+		std::vector<std::uint64_t> buffer;
+
+		// a full heap sort over 100M elements takes minutes, so full sorts only run on the smaller sizes
+		if (n <= 10'000'000) {
+			Run("std::sort", keys, buffer, [](const auto first, const auto last) { std::sort(first, last); });
+			Run("minmax_heap_sort", keys, buffer, [](const auto first, const auto last) { minmax_heap_sort(first, last); });
+			Run("std::sort_heap", keys, buffer, [](const auto first, const auto last) {
+				std::make_heap(first, last);
+				std::sort_heap(first, last);
+			});
+		}
+
+		RunTrim(keys, buffer, 0.001);
+		RunTrim(keys, buffer, 0.01);
+	}
+}
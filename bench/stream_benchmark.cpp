@@ -0,0 +1,87 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <istream>
+#include <iterator>
+#include <random>
+#include <streambuf>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "min_max_heap.hpp"
+
+namespace {
+
+// streams n keys as decimal text, one per line, generating the text on demand so that a feed of several gigabytes
+// needs no more memory than its read buffer
+class KeyFeed : public std::streambuf {
+
+public:
+	KeyFeed(const std::int64_t n, const bool ascending) : remaining_{n}, ascending_{ascending} {}
+
+protected:
+	int_type underflow() override {
+		auto* const begin = buffer_;
+		auto* end = begin;
+		for (; remaining_ > 0 && end + kMaxLineLength <= buffer_ + kBufferSize; --remaining_) {
+			const auto key = ascending_ ? next_key_++ : engine_();
+			end += std::snprintf(end, kMaxLineLength, "%llu\n", static_cast<unsigned long long>(key));
+		}
+		setg(begin, begin, end);
+		return begin == end ? traits_type::eof() : traits_type::to_int_type(*begin);
+	}
+
+private:
+	static constexpr auto kBufferSize = 1 << 16;
+	static constexpr auto kMaxLineLength = 22;
+	char buffer_[kBufferSize];
+	std::int64_t remaining_;
+	bool ascending_;
+	std::uint64_t next_key_ = 0;
+	std::mt19937_64 engine_{42};
+};
+
+void Run(const std::int64_t n, const bool ascending) {
+	using Clock = std::chrono::steady_clock;
+	const std::string keys = ascending ? "ascending" : "random";
+
+	// parses the whole feed into a buffer and heapifies it after the end of the input
+	KeyFeed buffered_feed{n, ascending};
+	std::istream buffered_stream{&buffered_feed};
+	Clock::time_point end_of_input;
+	Clock::time_point ready;
+	auto result = benchmark::Measure(n, benchmark::PerfCounter::None(), [&] {
+		std::vector<std::uint64_t> buffer{
+			std::istream_iterator<std::uint64_t>{buffered_stream}, std::istream_iterator<std::uint64_t>{}};
+		end_of_input = Clock::now();
+		MinMaxHeap<std::uint64_t> heap{std::move(buffer)};
+		benchmark::DoNotOptimize(heap.Max());
+		ready = Clock::now();
+	});
+	auto ready_after_input = std::chrono::duration<double, std::milli>(ready - end_of_input).count();
+	benchmark::Report("stream", "buffer+build/" + keys, n, result, "ms_after_input", ready_after_input);
+
+	// sifts every key in as it is parsed
+	KeyFeed streamed_feed{n, ascending};
+	std::istream streamed_stream{&streamed_feed};
+	result = benchmark::Measure(n, benchmark::PerfCounter::None(), [&] {
+		MinMaxHeap<std::uint64_t> heap{
+			std::istream_iterator<std::uint64_t>{streamed_stream}, std::istream_iterator<std::uint64_t>{}};
+		end_of_input = Clock::now();
+		benchmark::DoNotOptimize(heap.Max());
+		ready = Clock::now();
+	});
+	ready_after_input = std::chrono::duration<double, std::milli>(ready - end_of_input).count();
+	benchmark::Report("stream", "streaming/" + keys, n, result, "ms_after_input", ready_after_input);
+}
+}
+
+// the default of 250M keys is a feed of about 5 GB of text
+BENCHMARK_SUITE(stream) {
+	for (const auto n : options.SizesOr({250'000'000})) {
+		Run(n, false);
+		Run(n, true);
+	}
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace bits {
+
+// index of the most significant set bit; value must not be zero
+inline int FloorLog2(const std::uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+	return 63 - __builtin_clzll(value);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	_BitScanReverse64(&index, value);
+	return static_cast<int>(index);
+#else
+	auto log = 0;
+	for (auto remaining = value >> 1; remaining != 0; remaining >>= 1) ++log;
+	return log;
+#endif
+}
+
+// index of the least significant set bit; value must not be zero
+inline int CountTrailingZeros(const std::uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_ctzll(value);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	_BitScanForward64(&index, value);
+	return static_cast<int>(index);
+#else
+	auto count = 0;
+	for (auto remaining = value; (remaining & 1) == 0; remaining >>= 1) ++count;
+	return count;
+#endif
+}
+
+constexpr bool IsPowerOfTwo(const std::uint64_t value) noexcept { return value != 0 && (value & (value - 1)) == 0; }
+
+constexpr int Log2(const std::uint64_t power_of_two) noexcept {
+	return power_of_two == 1 ? 0 : 1 + Log2(power_of_two >> 1);
+}
+
+// the least power of two that is not less than value
+constexpr std::uint64_t CeilPowerOfTwo(const std::uint64_t value) noexcept {
+	return value <= 1 ? 1 : std::uint64_t{2} * CeilPowerOfTwo((value + 1) / 2);
+}
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "bits.hpp"
+
+// Level-order container that stores every subtree of Levels consecutive levels of an Arity-ary tree in one
+// contiguous block, in the style of a B-heap. A sift that moves two levels down stays within a block, or moves to
+// the next block, instead of touching a new cache line on nearly every step. Blocks are allocated whole, so the
+// last block level may hold unused slots and T must be default constructible. Each block is padded to a power of
+// two slots and aligned to its size, up to a cache line, so a block that fits a cache line never straddles two.
+template <typename T, int Levels, int Arity = 2>
+class BlockedStorage {
+	static_assert(Levels > 0 && bits::IsPowerOfTwo(Arity) && Levels * bits::Log2(Arity) < 32);
+
+public:
+	BlockedStorage() = default;
+
+	template <typename TIterator>
+	BlockedStorage(TIterator begin, const TIterator& end) {
+		for (; begin != end; ++begin) push_back(*begin);
+	}
+
+	T& operator[](const std::size_t index) noexcept { return Slot(blocks_, Position(index)); }
+	const T& operator[](const std::size_t index) const noexcept { return Slot(blocks_, Position(index)); }
+
+	[[nodiscard]] std::size_t size() const noexcept { return size_; }
+	[[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+	// the largest size reachable without allocating, which is less than the slots of the allocated blocks because the
+	// first level of a block row places one element in each new block
+	[[nodiscard]] std::size_t capacity() const noexcept { return MaxSizeInBlocks(blocks_.capacity()); }
+	void reserve(const std::size_t capacity) { blocks_.reserve(BlockCount(capacity)); }
+	void shrink_to_fit() { blocks_.shrink_to_fit(); }
+
+	void clear() noexcept {
+		blocks_.clear();
+		size_ = 0;
+	}
+
+	void push_back(T value) {
+		const auto position = Position(size_);
+		if (position >= blocks_.size() * kBlockStride) blocks_.emplace_back();
+		Slot(blocks_, position) = std::move(value);
+		++size_;
+	}
+
+	void pop_back() {
+		assert(size_ > 0);
+		const auto position = Position(--size_);
+		if (position % kBlockStride == 0) {
+			blocks_.pop_back();
+		} else {
+			Slot(blocks_, position) = T{};
+		}
+	}
+
+	// the position of index counted in slots from the start of the first block, padding included
+	static std::size_t Position(const std::size_t index) noexcept {
+		const auto level = Level(index);
+		const auto block_level = level / Levels;
+		const auto local_level = level - block_level * Levels;
+		const auto level_offset = index - FirstIndexOfLevel(level);
+		const auto block_offset = level_offset >> local_level * kLog2Arity;
+		const auto blocks_above = FirstIndexOfLevel(block_level * Levels) / kBlockSize;
+		const auto local_offset = level_offset - (block_offset << local_level * kLog2Arity);
+		const auto local_index = FirstIndexOfLevel(local_level) + local_offset;
+		return (blocks_above + block_offset) * kBlockStride + local_index;
+	}
+
+	static constexpr std::size_t kBlockSize = ((std::size_t{1} << Levels * bits::Log2(Arity)) - 1) / (Arity - 1);
+	static constexpr std::size_t kBlockStride = bits::CeilPowerOfTwo(kBlockSize);
+
+private:
+	static constexpr std::size_t FirstIndexOfLevel(const std::size_t level) noexcept {
+		return ((std::size_t{1} << level * kLog2Arity) - 1) / (Arity - 1);
+	}
+
+	static std::size_t Level(const std::size_t index) noexcept {
+		return static_cast<std::size_t>(bits::FloorLog2((Arity - 1) * index + 1)) / kLog2Arity;
+	}
+
+	// the number of blocks that the first size elements occupy: every block of the block rows above the last element
+	// and, in its row, one block per element of the first level or all of them once a deeper level is reached
+	static std::size_t BlockCount(const std::size_t size) noexcept {
+		if (size == 0) return 0;
+		const auto level = Level(size - 1);
+		const auto block_level = level / Levels;
+		if (level % Levels != 0) return FirstIndexOfLevel((block_level + 1) * Levels) / kBlockSize;
+		return FirstIndexOfLevel(level) / kBlockSize + size - FirstIndexOfLevel(level);
+	}
+
+	// the inverse of BlockCount: the largest size whose elements fit into the given number of blocks
+	static std::size_t MaxSizeInBlocks(const std::size_t blocks) noexcept {
+		auto first = std::size_t{0};
+		for (auto row = std::size_t{1};; ++row) {
+			const auto next = FirstIndexOfLevel(row * Levels);
+			if (blocks < next / kBlockSize) return first + blocks - first / kBlockSize;
+			first = next;
+		}
+	}
+
+	static constexpr std::size_t kLog2Arity = bits::Log2(Arity);
+	static constexpr std::size_t kCacheLineSize = 64;
+	static constexpr std::size_t kBlockBytes = kBlockStride * sizeof(T);
+	// the largest power of two that divides the block size, so aligning to it adds no padding between blocks
+	static constexpr std::size_t kBlockAlignment =
+		std::max(alignof(T), std::min(kCacheLineSize, kBlockBytes & (~kBlockBytes + 1)));
+
+	struct alignas(kBlockAlignment) Block {
+		T slots[kBlockStride]{};
+	};
+
+	template <typename Blocks>
+	static auto& Slot(Blocks& blocks, const std::size_t position) noexcept {
+		return blocks[position / kBlockStride].slots[position % kBlockStride];
+	}
+
+	std::vector<Block> blocks_;
+	std::size_t size_ = 0;
+};
+
+// the number of levels whose subtree, padded to a power of two slots, fills one cache line
+template <typename T, int Arity = 2, std::size_t CacheLineSize = 64>
+constexpr int CacheLineBlockLevels() noexcept {
+	auto levels = 1;
+	while (bits::CeilPowerOfTwo(((std::size_t{1} << (levels + 1) * bits::Log2(Arity)) - 1) / (Arity - 1)) <=
+		   CacheLineSize / sizeof(T)) {
+		++levels;
+	}
+	return levels;
+}
+
+template <typename T, int Arity = 2>
+using CacheLineBlockedStorage = BlockedStorage<T, CacheLineBlockLevels<T, Arity>(), Arity>;
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "bits.hpp"
+
+// A double-ended priority queue for integer keys within a range [low, high] that is known up front. Every key has
+// a bucket that counts its copies, and a hierarchical bitmap marks the nonempty buckets: the bottom level holds one
+// bit per key, and each level above holds one bit per nonzero word of the level below, up to a single word. Finding
+// the first or last set bit on each level reaches the smallest or largest key in O(log_64 (high - low)), which is
+// two levels for ranges of up to 4096 keys and four for a million; the extremes are cached, so Min and Max are loads.
+template <typename T>
+class BucketDEPQ {
+	static_assert(std::is_integral_v<T>);
+
+public:
+	BucketDEPQ(const T low, const T high, std::initializer_list<T> data = {})
+		: BucketDEPQ{low, high, std::cbegin(data), std::cend(data)} {}
+
+	template <typename TIterator>
+	BucketDEPQ(const T low, const T high, TIterator begin, const TIterator& end)
+		: low_{low}, counts_(Bucket(high) + 1) {
+		assert(low <= high);
+		for (auto words = counts_.size(); words > 1 || levels_.empty();) {
+			words = (words + kWordBits - 1) / kWordBits;
+			levels_.emplace_back(words);
+		}
+		for (; begin != end; ++begin) Add(*begin);
+	}
+
+	void Add(const T value) {
+		const auto bucket = Bucket(value);
+		assert(bucket < counts_.size());
+		assert(counts_[bucket] < std::numeric_limits<Count>::max());
+
+		if (counts_[bucket]++ == 0) Mark(bucket);
+		if (size_++ == 0) {
+			min_ = max_ = value;
+		} else if (value < min_) {
+			min_ = value;
+		} else if (max_ < value) {
+			max_ = value;
+		}
+	}
+
+	T RemoveMin() {
+		assert(size_ > 0);
+		const auto min_value = min_;
+		const auto bucket = Bucket(min_value);
+		if (--counts_[bucket] == 0) {
+			Unmark(bucket);
+			if (size_ > 1) min_ = Key(FindFirst());
+		}
+		--size_;
+		return min_value;
+	}
+
+	T RemoveMax() {
+		assert(size_ > 0);
+		const auto max_value = max_;
+		const auto bucket = Bucket(max_value);
+		if (--counts_[bucket] == 0) {
+			Unmark(bucket);
+			if (size_ > 1) max_ = Key(FindLast());
+		}
+		--size_;
+		return max_value;
+	}
+
+	[[nodiscard]] const T& Min() const noexcept {
+		assert(size_ > 0);
+		return min_;
+	}
+
+	[[nodiscard]] const T& Max() const noexcept {
+		assert(size_ > 0);
+		return max_;
+	}
+
+	[[nodiscard]] std::size_t Size() const noexcept { return size_; }
+
+private:
+	using Word = std::uint64_t;
+	using Count = std::uint32_t;
+	using Unsigned = std::make_unsigned_t<T>;
+	static constexpr std::size_t kWordBits = 64;
+
+	// offsets are taken in the unsigned type, where they cannot overflow even for a range spanning all of T
+	[[nodiscard]] std::size_t Bucket(const T value) const noexcept {
+		assert(low_ <= value);
+		return static_cast<Unsigned>(static_cast<Unsigned>(value) - static_cast<Unsigned>(low_));
+	}
+
+	[[nodiscard]] T Key(const std::size_t bucket) const noexcept {
+		return static_cast<T>(static_cast<Unsigned>(low_) + bucket);
+	}
+
+	// sets the bit of a bucket that became nonempty, and the bits above it of words that were zero until now
+	void Mark(std::size_t index) noexcept {
+		for (auto& level : levels_) {
+			auto& word = level[index / kWordBits];
+			const auto was_zero = word == 0;
+			word |= Word{1} << index % kWordBits;
+			if (!was_zero) return;
+			index /= kWordBits;
+		}
+	}
+
+	// clears the bit of a bucket that became empty, and the bits above it of words that are zero now
+	void Unmark(std::size_t index) noexcept {
+		for (auto& level : levels_) {
+			auto& word = level[index / kWordBits];
+			word &= ~(Word{1} << index % kWordBits);
+			if (word != 0) return;
+			index /= kWordBits;
+		}
+	}
+
+	[[nodiscard]] std::size_t FindFirst() const noexcept {
+		auto index = std::size_t{0};
+		for (auto level = levels_.size(); level-- > 0;) {
+			index = index * kWordBits + static_cast<std::size_t>(bits::CountTrailingZeros(levels_[level][index]));
+		}
+		return index;
+	}
+
+	[[nodiscard]] std::size_t FindLast() const noexcept {
+		auto index = std::size_t{0};
+		for (auto level = levels_.size(); level-- > 0;) {
+			index = index * kWordBits + static_cast<std::size_t>(bits::FloorLog2(levels_[level][index]));
+		}
+		return index;
+	}
+
+	T low_;
+	std::vector<Count> counts_;
+	std::vector<std::vector<Word>> levels_;
+	std::size_t size_ = 0;
+	T min_{};
+	T max_{};
+};
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "min_max_heap.hpp"
+
+// A MinMaxHeap fronted by a small sorted insertion buffer, in the style of sequence heaps. Additions shift into
+// the buffer, which stays within a few cache lines, and Min and Max compare the ends of the buffer with the
+// extremes of the heap. A full buffer is appended to the heap as one batch, whose ancestors are rebuilt level by
+// level instead of sifting every element up along its own scattered path.
+template <typename T, int BufferSize = 16, typename Policy = MinMaxHeapPolicy, typename Compare = std::less<T>>
+class BufferedMinMaxHeap {
+	static_assert(BufferSize > 0);
+	using Heap = MinMaxHeap<T, Policy, Compare>;
+	using Index = typename Policy::IndexType;
+
+public:
+	BufferedMinMaxHeap(std::initializer_list<T> data = {}, const Compare& compare = Compare{})
+		: BufferedMinMaxHeap{std::cbegin(data), std::cend(data), compare} {}
+
+	template <typename TIterator>
+	BufferedMinMaxHeap(const TIterator& begin, const TIterator& end, const Compare& compare = Compare{})
+		: heap_{begin, end, compare}, compare_{compare} {
+		buffer_.reserve(BufferSize);
+	}
+
+	void Add(T value) {
+		if (buffer_.size() == BufferSize) Flush();
+		const auto position = std::upper_bound(buffer_.begin(), buffer_.end(), value, compare_);
+		buffer_.insert(position, std::move(value));
+	}
+
+	T RemoveMin() {
+		assert(Size() > 0);
+		if (!IsMinBuffered()) return heap_.RemoveMin();
+
+		auto min_value = std::move(buffer_.front());
+		buffer_.erase(buffer_.begin());
+		return min_value;
+	}
+
+	T RemoveMax() {
+		assert(Size() > 0);
+		if (!IsMaxBuffered()) return heap_.RemoveMax();
+
+		auto max_value = std::move(buffer_.back());
+		buffer_.pop_back();
+		return max_value;
+	}
+
+	[[nodiscard]] const T& Min() const {
+		assert(Size() > 0);
+		return IsMinBuffered() ? buffer_.front() : heap_.Min();
+	}
+
+	[[nodiscard]] const T& Max() const {
+		assert(Size() > 0);
+		return IsMaxBuffered() ? buffer_.back() : heap_.Max();
+	}
+
+	[[nodiscard]] Index Size() const noexcept { return static_cast<Index>(heap_.Size() + buffer_.size()); }
+
+	// moves the buffered elements into the heap in one batch
+	void Flush() {
+		heap_.AddRange(std::make_move_iterator(buffer_.begin()), std::make_move_iterator(buffer_.end()));
+		buffer_.clear();
+	}
+
+private:
+	// ties go to the heap, which leaves the buffer to absorb more additions
+	[[nodiscard]] bool IsMinBuffered() const {
+		return !buffer_.empty() && (heap_.Size() == 0 || compare_(buffer_.front(), heap_.Min()));
+	}
+
+	[[nodiscard]] bool IsMaxBuffered() const {
+		return !buffer_.empty() && (heap_.Size() == 0 || compare_(heap_.Max(), buffer_.back()));
+	}
+
+	Heap heap_;
+	std::vector<T> buffer_;
+	Compare compare_;
+};
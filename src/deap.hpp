@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cassert>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "bits.hpp"
+
+// A deap is a complete binary tree with an empty root whose left subtree is a min-heap and whose right subtree is
+// a max-heap. Every node i of the min-heap is no greater than its partner i + 2^(level - 1) in the max-heap, or
+// the parent of that partner if it does not exist. Nodes are numbered from one at the root, so the node of
+// data_[i] is i + 2.
+template <typename T>
+class Deap {
+
+public:
+	Deap(std::initializer_list<T> data = {})
+		: Deap{std::cbegin(data), std::cend(data)} {}
+
+	template <typename TIterator>
+	Deap(TIterator begin, const TIterator& end) {
+		for (; begin != end; ++begin) Add(*begin);
+	}
+
+	void Add(T value) {
+		data_.push_back(value);
+		const auto node = LastNode();
+
+		if (IsMinHeapNode(node)) {
+			const auto partner = MaxPartner(node);
+			if (partner > kRootNode && At(partner) < value) {
+				At(node) = std::move(At(partner));
+				HeapifyUpMax(partner, std::move(value));
+			} else {
+				HeapifyUpMin(node, std::move(value));
+			}
+		} else {
+			const auto partner = MinPartner(node);
+			if (value < At(partner)) {
+				At(node) = std::move(At(partner));
+				HeapifyUpMin(partner, std::move(value));
+			} else {
+				HeapifyUpMax(node, std::move(value));
+			}
+		}
+	}
+
+	T RemoveMin() {
+		assert(!data_.empty());
+		auto min_value = std::move(At(kMinNode));
+		auto value = std::move(data_.back());
+		data_.pop_back();
+		if (data_.empty()) return min_value;
+
+		auto node = kMinNode;
+		while (2 * node <= LastNode()) {
+			auto child = 2 * node;
+			if (child + 1 <= LastNode() && At(child + 1) < At(child)) ++child;
+			At(node) = std::move(At(child));
+			node = child;
+		}
+
+		const auto partner = MaxPartner(node);
+		if (partner > kRootNode && At(partner) < value) {
+			At(node) = std::move(At(partner));
+			HeapifyUpMax(partner, std::move(value));
+		} else {
+			HeapifyUpMin(node, std::move(value));
+		}
+		return min_value;
+	}
+
+	T RemoveMax() {
+		assert(!data_.empty());
+		if (data_.size() == 1) return RemoveMin();
+
+		auto max_value = std::move(At(kMaxNode));
+		auto value = std::move(data_.back());
+		data_.pop_back();
+		if (data_.size() == 1) return max_value;
+
+		auto node = kMaxNode;
+		while (2 * node <= LastNode()) {
+			auto child = 2 * node;
+			if (child + 1 <= LastNode() && At(child) < At(child + 1)) ++child;
+			At(node) = std::move(At(child));
+			node = child;
+		}
+
+		// a max-heap leaf also partners the children of its min-heap partner, the largest of which bounds it
+		auto partner = MinPartner(node);
+		if (2 * partner <= LastNode()) {
+			const auto child = 2 * partner;
+			partner = child + 1 <= LastNode() && At(child) < At(child + 1) ? child + 1 : child;
+		}
+
+		if (value < At(partner)) {
+			At(node) = std::move(At(partner));
+			HeapifyUpMin(partner, std::move(value));
+		} else {
+			HeapifyUpMax(node, std::move(value));
+		}
+		return max_value;
+	}
+
+	[[nodiscard]] const T& Min() const noexcept {
+		assert(!data_.empty());
+		return At(kMinNode);
+	}
+
+	[[nodiscard]] const T& Max() const noexcept {
+		assert(!data_.empty());
+		return data_.size() == 1 ? At(kMinNode) : At(kMaxNode);
+	}
+
+	[[nodiscard]] int Size() const noexcept { return static_cast<int>(data_.size()); }
+
+private:
+	static int LevelOffset(const int node) noexcept {
+		return 1 << (bits::FloorLog2(static_cast<std::uint64_t>(node)) - 1);
+	}
+	static bool IsMinHeapNode(const int node) noexcept { return (node & LevelOffset(node)) == 0; }
+
+	static int MinPartner(const int node) noexcept { return node - LevelOffset(node); }
+
+	[[nodiscard]] int MaxPartner(const int node) const noexcept {
+		const auto partner = node + LevelOffset(node);
+		return partner <= LastNode() ? partner : partner / 2;
+	}
+
+	[[nodiscard]] int LastNode() const noexcept { return Size() + 1; }
+
+	void HeapifyUpMin(int node, T value) {
+		for (auto parent = node / 2; parent > kRootNode && value < At(parent); parent = node / 2) {
+			At(node) = std::move(At(parent));
+			node = parent;
+		}
+		At(node) = std::move(value);
+	}
+
+	void HeapifyUpMax(int node, T value) {
+		for (auto parent = node / 2; parent > kRootNode && At(parent) < value; parent = node / 2) {
+			At(node) = std::move(At(parent));
+			node = parent;
+		}
+		At(node) = std::move(value);
+	}
+
+	T& At(const int node) noexcept { return data_[node - kMinNode]; }
+	const T& At(const int node) const noexcept { return data_[node - kMinNode]; }
+
+	static constexpr auto kRootNode = 1;
+	static constexpr auto kMinNode = 2;
+	static constexpr auto kMaxNode = 3;
+	std::vector<T> data_;
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "buffered_min_max_heap.hpp"
+#include "deap.hpp"
+#include "interval_heap.hpp"
+#include "meldable_min_max_heap.hpp"
+#include "min_max_heap.hpp"
+#include "symmetric_min_max_heap.hpp"
+#include "twin_heap.hpp"
+
+// Backends for DoubleEndedPriorityQueue. Each provides Add, Min, Max, RemoveMin, RemoveMax and Size, so a queue can
+// switch implementations by changing its backend alone.
+struct MinMaxHeapBackend {
+	template <typename T>
+	using Type = MinMaxHeap<T>;
+};
+
+struct BufferedMinMaxHeapBackend {
+	template <typename T>
+	using Type = BufferedMinMaxHeap<T>;
+};
+
+struct IntervalHeapBackend {
+	template <typename T>
+	using Type = IntervalHeap<T>;
+};
+
+struct SymmetricMinMaxHeapBackend {
+	template <typename T>
+	using Type = SymmetricMinMaxHeap<T>;
+};
+
+struct DeapBackend {
+	template <typename T>
+	using Type = Deap<T>;
+};
+
+struct MeldableMinMaxHeapBackend {
+	template <typename T>
+	using Type = MeldableMinMaxHeap<T>;
+};
+
+struct TwinHeapBackend {
+	template <typename T>
+	using Type = TwinHeap<T>;
+};
+
+template <typename T, typename Backend = MinMaxHeapBackend>
+using DoubleEndedPriorityQueue = typename Backend::template Type<T>;
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+// Allocator that backs large buffers with 2 MB pages so that random accesses across a multi-gigabyte heap miss
+// the TLB far less often. On Linux, buffers of at least one huge page are mapped with MAP_HUGETLB from the
+// reserved huge page pool, and when the pool is empty or not configured, with an aligned anonymous mapping that
+// is marked MADV_HUGEPAGE for transparent huge pages. Smaller buffers, and every buffer on other platforms, come
+// from std::allocator.
+template <typename T>
+class HugePageAllocator {
+
+public:
+	using value_type = T;
+
+	static constexpr std::size_t kHugePageSize = std::size_t{2} << 20;
+
+	HugePageAllocator() noexcept = default;
+
+	template <typename U>
+	HugePageAllocator(const HugePageAllocator<U>&) noexcept {}
+
+	[[nodiscard]] T* allocate(const std::size_t n) {
+		if (!IsMapped(n)) return std::allocator<T>{}.allocate(n);
+#ifdef __linux__
+		const auto length = MappedLength(n);
+
+		if (auto* const address = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+				MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0); address != MAP_FAILED) {
+			return static_cast<T*>(address);
+		}
+
+		// over-allocate by one huge page and trim both ends so that the mapping starts on a huge page boundary,
+		// which transparent huge pages require
+		auto* const unaligned = static_cast<char*>(
+			mmap(nullptr, length + kHugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+		if (unaligned == MAP_FAILED) throw std::bad_alloc{};
+
+		const auto misalignment = reinterpret_cast<std::uintptr_t>(unaligned) % kHugePageSize;
+		const auto head = misalignment == 0 ? 0 : kHugePageSize - misalignment;
+		auto* const aligned = unaligned + head;
+		if (head > 0) munmap(unaligned, head);
+		munmap(aligned + length, kHugePageSize - head);
+
+		madvise(aligned, length, MADV_HUGEPAGE);
+		return reinterpret_cast<T*>(aligned);
+#else
+		return std::allocator<T>{}.allocate(n);
+#endif
+	}
+
+	void deallocate(T* const data, const std::size_t n) noexcept {
+		if (!IsMapped(n)) return std::allocator<T>{}.deallocate(data, n);
+#ifdef __linux__
+		munmap(data, MappedLength(n));
+#endif
+	}
+
+	// whether a buffer of n elements is mapped with huge pages rather than obtained from std::allocator
+	[[nodiscard]] static constexpr bool IsMapped([[maybe_unused]] const std::size_t n) noexcept {
+#ifdef __linux__
+		return n >= kHugePageSize / sizeof(T);
+#else
+		return false;
+#endif
+	}
+
+private:
+	static constexpr std::size_t MappedLength(const std::size_t n) noexcept {
+		return (n * sizeof(T) + kHugePageSize - 1) / kHugePageSize * kHugePageSize;
+	}
+};
+
+template <typename T, typename U>
+constexpr bool operator==(const HugePageAllocator<T>&, const HugePageAllocator<U>&) noexcept {
+	return true;
+}
+
+template <typename T, typename U>
+constexpr bool operator!=(const HugePageAllocator<T>&, const HugePageAllocator<U>&) noexcept {
+	return false;
+}
+
+// level-order container for MinMaxHeapPolicy::Storage that keeps large heaps on huge pages
+template <typename T>
+using HugePageStorage = std::vector<T, HugePageAllocator<T>>;
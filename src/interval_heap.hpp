@@ -0,0 +1,149 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+// A double-ended priority queue in which every node holds an interval [data_[2k], data_[2k + 1]] containing the
+// intervals of its children. All levels are alike, so there is no alternating min/max level logic, and each
+// side sifts through half as many nodes as a min-max heap of the same size. The last node may hold a single
+// element which serves as both of its endpoints.
+template <typename T>
+class IntervalHeap {
+
+public:
+	IntervalHeap(std::initializer_list<T> data = {})
+		: IntervalHeap{std::cbegin(data), std::cend(data)} {}
+
+	template <typename TIterator>
+	IntervalHeap(const TIterator& begin, const TIterator& end) : data_(begin, end) {
+		for (auto node = NodeCount() - 1; node >= 0; --node) {
+			const auto low = LowIndex(node);
+			const auto high = HighIndex(node);
+			if (data_[high] < data_[low]) std::swap(data_[low], data_[high]);
+			HeapifyDownMin(low);
+			HeapifyDownMax(HighIndex(node));
+		}
+	}
+
+	void Add(T value) {
+		data_.push_back(std::move(value));
+		const auto index = Size() - 1;
+
+		if (index % 2 == 1) {
+			if (data_[index] < data_[index - 1]) {
+				std::swap(data_[index], data_[index - 1]);
+				HeapifyUpMin(index - 1);
+			} else {
+				HeapifyUpMax(index);
+			}
+		} else if (index > 0) {
+			const auto parent = ParentNode(index / 2);
+			if (data_[index] < data_[LowIndex(parent)]) {
+				HeapifyUpMin(index);
+			} else if (data_[HighIndex(parent)] < data_[index]) {
+				HeapifyUpMax(index);
+			}
+		}
+	}
+
+	T RemoveMin() {
+		assert(!data_.empty());
+		auto min_value = std::move(data_[0]);
+		if (data_.size() > 1) data_[0] = std::move(data_.back());
+		data_.pop_back();
+		if (!data_.empty()) HeapifyDownMin(0);
+		return min_value;
+	}
+
+	T RemoveMax() {
+		assert(!data_.empty());
+		if (data_.size() <= 2) {
+			auto max_value = std::move(data_.back());
+			data_.pop_back();
+			return max_value;
+		}
+		auto max_value = std::move(data_[1]);
+		data_[1] = std::move(data_.back());
+		data_.pop_back();
+		HeapifyDownMax(1);
+		return max_value;
+	}
+
+	[[nodiscard]] const T& Min() const noexcept {
+		assert(!data_.empty());
+		return data_[0];
+	}
+
+	[[nodiscard]] const T& Max() const noexcept {
+		assert(!data_.empty());
+		return data_[HighIndex(0)];
+	}
+
+	[[nodiscard]] int Size() const noexcept { return static_cast<int>(data_.size()); }
+
+private:
+	[[nodiscard]] int NodeCount() const noexcept { return (Size() + 1) / 2; }
+
+	static constexpr int LeftChildNode(const int node) noexcept { return 2 * node + 1; }
+	static constexpr int RightChildNode(const int node) noexcept { return 2 * node + 2; }
+	static constexpr int ParentNode(const int node) noexcept { return (node - 1) / 2; }
+
+	static constexpr int LowIndex(const int node) noexcept { return 2 * node; }
+
+	// the single element of an incomplete last node is its own upper endpoint
+	[[nodiscard]] int HighIndex(const int node) const noexcept { return std::min(2 * node + 1, Size() - 1); }
+
+	void HeapifyUpMin(int index) {
+		for (auto node = index / 2; node > 0; node = ParentNode(node)) {
+			const auto parent = LowIndex(ParentNode(node));
+			if (!(data_[index] < data_[parent])) return;
+			std::swap(data_[index], data_[parent]);
+			index = parent;
+		}
+	}
+
+	void HeapifyUpMax(int index) {
+		for (auto node = index / 2; node > 0; node = ParentNode(node)) {
+			const auto parent = HighIndex(ParentNode(node));
+			if (!(data_[parent] < data_[index])) return;
+			std::swap(data_[index], data_[parent]);
+			index = parent;
+		}
+	}
+
+	void HeapifyDownMin(int index) {
+		for (auto node = index / 2; LeftChildNode(node) < NodeCount(); node = index / 2) {
+			auto child = LeftChildNode(node);
+			if (RightChildNode(node) < NodeCount() && data_[LowIndex(child + 1)] < data_[LowIndex(child)]) ++child;
+
+			const auto child_low = LowIndex(child);
+			if (!(data_[child_low] < data_[index])) return;
+			std::swap(data_[child_low], data_[index]);
+			index = child_low;
+
+			const auto child_high = HighIndex(child);
+			if (data_[child_high] < data_[child_low]) std::swap(data_[child_low], data_[child_high]);
+		}
+	}
+
+	void HeapifyDownMax(int index) {
+		for (auto node = index / 2; LeftChildNode(node) < NodeCount(); node = index / 2) {
+			auto child = LeftChildNode(node);
+			if (RightChildNode(node) < NodeCount() && data_[HighIndex(child)] < data_[HighIndex(child + 1)]) ++child;
+
+			const auto child_high = HighIndex(child);
+			if (!(data_[index] < data_[child_high])) return;
+			std::swap(data_[child_high], data_[index]);
+			index = child_high;
+
+			const auto child_low = LowIndex(child);
+			if (data_[child_high] < data_[child_low]) std::swap(data_[child_low], data_[child_high]);
+		}
+	}
+
+	std::vector<T> data_;
+};
@@ -0,0 +1,295 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// A node-based double-ended priority queue that threads every element through a min-ordered and a max-ordered
+// pairing heap. Melding links the two pairs of roots in O(1), and removing an extreme from one heap unlinks the
+// same node from the other in O(log n) amortized. Nodes come from a pool of geometrically growing chunks that
+// follows them when heaps are melded.
+template <typename T>
+class MeldableMinMaxHeap {
+
+	struct Node;
+
+	struct Link {
+		Node* child = nullptr;
+		Node* sibling = nullptr;
+		Node* previous = nullptr; // the parent for a first child, otherwise the preceding sibling
+	};
+
+	struct Node {
+		template <typename... Args>
+		explicit Node(Args&&... args) : value{std::forward<Args>(args)...} {}
+
+		T value;
+		Link min;
+		Link max;
+	};
+
+	class NodePool {
+
+	public:
+		NodePool() = default;
+
+		NodePool(NodePool&& other) noexcept
+			: chunks_{std::move(other.chunks_)},
+			  free_{std::exchange(other.free_, nullptr)},
+			  free_tail_{std::exchange(other.free_tail_, nullptr)},
+			  capacity_{std::exchange(other.capacity_, 0)} {}
+
+		NodePool& operator=(NodePool&& other) noexcept {
+			chunks_ = std::move(other.chunks_);
+			free_ = std::exchange(other.free_, nullptr);
+			free_tail_ = std::exchange(other.free_tail_, nullptr);
+			capacity_ = std::exchange(other.capacity_, 0);
+			return *this;
+		}
+
+		template <typename... Args>
+		Node* Allocate(Args&&... args) {
+			if (free_ == nullptr) Grow();
+			auto* const slot = free_;
+			auto* const next = slot->next;
+			Node* node;
+			try {
+				node = new (slot) Node{std::forward<Args>(args)...};
+			} catch (...) {
+				// the slot stays at the head of the free list, so a throwing constructor does not leak it
+				slot->next = next;
+				throw;
+			}
+			free_ = next;
+			if (free_ == nullptr) free_tail_ = nullptr;
+			return node;
+		}
+
+		void Release(Node* const node) noexcept {
+			node->~Node();
+			auto* const slot = reinterpret_cast<Slot*>(node);
+			slot->next = free_;
+			free_ = slot;
+			if (free_tail_ == nullptr) free_tail_ = slot;
+		}
+
+		void Splice(NodePool&& other) {
+			// inserting the range keeps the geometric growth of chunks_, which an exact reserve on every splice would
+			// defeat by reallocating the whole chunk list each time
+			chunks_.insert(chunks_.end(), std::make_move_iterator(other.chunks_.begin()),
+				std::make_move_iterator(other.chunks_.end()));
+			capacity_ += std::exchange(other.capacity_, 0);
+			other.chunks_.clear();
+
+			if (other.free_ != nullptr) {
+				if (free_tail_ == nullptr) {
+					free_ = other.free_;
+				} else {
+					free_tail_->next = other.free_;
+				}
+				free_tail_ = other.free_tail_;
+				other.free_ = other.free_tail_ = nullptr;
+			}
+		}
+
+	private:
+		union Slot {
+			Slot() noexcept : next{nullptr} {}
+			~Slot() {}
+
+			Slot* next;
+			alignas(Node) std::byte storage[sizeof(Node)];
+		};
+
+		void Grow() {
+			const auto size = std::max<std::size_t>(kMinChunkSize, capacity_);
+			chunks_.push_back(std::make_unique<Slot[]>(size));
+			auto* const chunk = chunks_.back().get();
+			for (std::size_t i = 0; i + 1 < size; ++i) chunk[i].next = &chunk[i + 1];
+			free_ = chunk;
+			free_tail_ = &chunk[size - 1];
+			capacity_ += size;
+		}
+
+		static constexpr std::size_t kMinChunkSize = 16;
+		std::vector<std::unique_ptr<Slot[]>> chunks_;
+		Slot* free_ = nullptr;
+		Slot* free_tail_ = nullptr;
+		std::size_t capacity_ = 0;
+	};
+
+public:
+	MeldableMinMaxHeap(std::initializer_list<T> data = {})
+		: MeldableMinMaxHeap{std::cbegin(data), std::cend(data)} {}
+
+	template <typename TIterator>
+	MeldableMinMaxHeap(TIterator begin, const TIterator& end) {
+		for (; begin != end; ++begin) Add(*begin);
+	}
+
+	MeldableMinMaxHeap(const MeldableMinMaxHeap&) = delete;
+	MeldableMinMaxHeap& operator=(const MeldableMinMaxHeap&) = delete;
+
+	MeldableMinMaxHeap(MeldableMinMaxHeap&& other) noexcept
+		: pool_{std::move(other.pool_)},
+		  min_root_{std::exchange(other.min_root_, nullptr)},
+		  max_root_{std::exchange(other.max_root_, nullptr)},
+		  size_{std::exchange(other.size_, 0)} {}
+
+	MeldableMinMaxHeap& operator=(MeldableMinMaxHeap&& other) noexcept {
+		if (this != &other) {
+			DestroyValues();
+			pool_ = std::move(other.pool_);
+			min_root_ = std::exchange(other.min_root_, nullptr);
+			max_root_ = std::exchange(other.max_root_, nullptr);
+			size_ = std::exchange(other.size_, 0);
+		}
+		return *this;
+	}
+
+	~MeldableMinMaxHeap() { DestroyValues(); }
+
+	void Add(T value) {
+		auto* const node = pool_.Allocate(std::move(value));
+		min_root_ = Meld<&Node::min>(min_root_, node, kLessComparator);
+		max_root_ = Meld<&Node::max>(max_root_, node, kGreaterComparator);
+		++size_;
+	}
+
+	// moves every element of other into this heap, leaving other empty; the roots are linked in O(1) and the chunks
+	// of the pool of other are appended in amortized time linear in their number
+	void Meld(MeldableMinMaxHeap&& other) {
+		if (this == &other) return;
+		pool_.Splice(std::move(other.pool_));
+		min_root_ = Meld<&Node::min>(min_root_, std::exchange(other.min_root_, nullptr), kLessComparator);
+		max_root_ = Meld<&Node::max>(max_root_, std::exchange(other.max_root_, nullptr), kGreaterComparator);
+		size_ += std::exchange(other.size_, 0);
+	}
+
+	T RemoveMin() {
+		assert(size_ > 0);
+		auto* const node = min_root_;
+		min_root_ = MergePairs<&Node::min>(node->min.child, kLessComparator);
+		max_root_ = Remove<&Node::max>(max_root_, node, kGreaterComparator);
+		return Release(node);
+	}
+
+	T RemoveMax() {
+		assert(size_ > 0);
+		auto* const node = max_root_;
+		max_root_ = MergePairs<&Node::max>(node->max.child, kGreaterComparator);
+		min_root_ = Remove<&Node::min>(min_root_, node, kLessComparator);
+		return Release(node);
+	}
+
+	[[nodiscard]] const T& Min() const noexcept {
+		assert(size_ > 0);
+		return min_root_->value;
+	}
+
+	[[nodiscard]] const T& Max() const noexcept {
+		assert(size_ > 0);
+		return max_root_->value;
+	}
+
+	[[nodiscard]] int Size() const noexcept { return size_; }
+
+private:
+	// links two roots by making the lesser the parent of the other
+	template <Link Node::*L, typename Comparator>
+	static Node* Meld(Node* a, Node* b, const Comparator& comparator) noexcept {
+		if (a == nullptr) return b;
+		if (b == nullptr) return a;
+		if (comparator(b->value, a->value)) std::swap(a, b);
+
+		auto& a_link = a->*L;
+		auto& b_link = b->*L;
+		b_link.sibling = a_link.child;
+		if (a_link.child != nullptr) (a_link.child->*L).previous = b;
+		b_link.previous = a;
+		a_link.child = b;
+		return a;
+	}
+
+	// melds a list of siblings into one root with the standard two-pass pairing
+	template <Link Node::*L, typename Comparator>
+	static Node* MergePairs(Node* first, const Comparator& comparator) noexcept {
+		Node* pairs = nullptr;
+		while (first != nullptr) {
+			auto* const second = (first->*L).sibling;
+			auto* const next = second != nullptr ? (second->*L).sibling : nullptr;
+			Detach<L>(first);
+			if (second != nullptr) Detach<L>(second);
+
+			auto* const pair = Meld<L>(first, second, comparator);
+			(pair->*L).sibling = pairs;
+			pairs = pair;
+			first = next;
+		}
+
+		Node* root = nullptr;
+		while (pairs != nullptr) {
+			auto* const next = (pairs->*L).sibling;
+			(pairs->*L).sibling = nullptr;
+			root = Meld<L>(pairs, root, comparator);
+			pairs = next;
+		}
+		return root;
+	}
+
+	// unlinks an arbitrary node and melds its children back into the heap
+	template <Link Node::*L, typename Comparator>
+	static Node* Remove(Node* const root, Node* const node, const Comparator& comparator) noexcept {
+		auto& link = node->*L;
+		if (node == root) return MergePairs<L>(link.child, comparator);
+
+		auto& previous = link.previous->*L;
+		(previous.child == node ? previous.child : previous.sibling) = link.sibling;
+		if (link.sibling != nullptr) (link.sibling->*L).previous = link.previous;
+		return Meld<L>(root, MergePairs<L>(link.child, comparator), comparator);
+	}
+
+	template <Link Node::*L>
+	static void Detach(Node* const node) noexcept {
+		(node->*L).sibling = nullptr;
+		(node->*L).previous = nullptr;
+	}
+
+	T Release(Node* const node) {
+		auto value = std::move(node->value);
+		pool_.Release(node);
+		--size_;
+		return value;
+	}
+
+	void DestroyValues() noexcept {
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			std::vector<Node*> pending;
+			if (min_root_ != nullptr) pending.push_back(min_root_);
+			while (!pending.empty()) {
+				auto* const node = pending.back();
+				pending.pop_back();
+				if (node->min.child != nullptr) pending.push_back(node->min.child);
+				if (node->min.sibling != nullptr) pending.push_back(node->min.sibling);
+				node->~Node();
+			}
+		}
+		min_root_ = max_root_ = nullptr;
+		size_ = 0;
+	}
+
+	static constexpr auto kLessComparator = std::less<T>{};
+	static constexpr auto kGreaterComparator = std::greater<T>{};
+	NodePool pool_;
+	Node* min_root_ = nullptr;
+	Node* max_root_ = nullptr;
+	int size_ = 0;
+};
@@ -1,179 +1,303 @@
 ﻿#pragma once
 
 #include <algorithm>
-#include <cmath>
+#include <cassert>
+#include <cstddef>
 #include <functional>
-#include <vector>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
 
-template <typename T>
+#include "min_max_heap_algorithm.hpp"
+
+namespace min_max_heap_detail {
+template <typename Storage, typename = void>
+constexpr bool kHasIterators = false;
+
+template <typename Storage>
+constexpr bool kHasIterators<Storage, std::void_t<decltype(std::begin(std::declval<Storage&>()))>> = true;
+}
+
+template <typename T, typename Policy = MinMaxHeapPolicy, typename Compare = std::less<T>>
 class MinMaxHeap {
+	using Storage = typename Policy::template Storage<T>;
+	using Sifter = min_max_heap_detail::Sifter<T, Policy, Storage&, Compare>;
+	using Index = typename Sifter::Index;
 
 public:
-	MinMaxHeap(std::initializer_list<T> data = {})
-		: MinMaxHeap{std::cbegin(data), std::cend(data)} {}
+	MinMaxHeap(std::initializer_list<T> data = {}, const Compare& compare = Compare{})
+		: MinMaxHeap{std::cbegin(data), std::cend(data), compare} {}
 
 	template <typename TIterator>
-	MinMaxHeap(const TIterator& begin, const TIterator& end) : data_(begin, end) {
-		for (auto i = ParentIndex(static_cast<int>(end - begin) - 1); i >= 0; --i) {
-			HeapifyDown(i);
+	MinMaxHeap(const TIterator& begin, const TIterator& end, const Compare& compare = Compare{})
+		: compare_{compare} {
+		using Category = typename std::iterator_traits<TIterator>::iterator_category;
+		if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+			data_ = Storage(begin, end);
+			if constexpr (!Policy::kLazyHeapify) Build();
+		} else {
+			// a single-pass range, such as a stream, is sifted in element by element as it is read, so the heap is
+			// ready as soon as the input ends instead of after a second pass over a buffered copy
+			for (auto it = begin; it != end; ++it) Add(*it);
+		}
+	}
+
+	// adopts the buffer of data and arranges its elements in place without copying them
+	explicit MinMaxHeap(Storage&& data, const Compare& compare = Compare{})
+		: data_(std::move(data)), compare_{compare} {
+		if constexpr (!Policy::kLazyHeapify) Build();
+	}
+
+	// hands the buffer back in heap order and leaves the heap empty
+	[[nodiscard]] Storage Release() && {
+		Settle();
+		// the sorted order of a small heap is no min-max heap order, so it is rearranged before leaving the class
+		if (linear_) Sift().Heapify();
+		return TakeData();
+	}
+
+	// hands the buffer back sorted in ascending order and leaves the heap empty
+	[[nodiscard]] Storage TakeSorted() && {
+		if constexpr (min_max_heap_detail::kHasIterators<Storage>) {
+			// sorting arranges the appended elements of a lazy heap too, so they need not be folded in first
+			const auto unsettled = Policy::kLazyHeapify && settled_size_ < Size();
+			if (!linear_ || unsettled) std::sort(std::begin(data_), std::end(data_), compare_);
+			settled_size_ = Size();
+		} else {
+			// a storage without iterators, like BlockedStorage, is sorted through operator[] by moving each maximum
+			// behind the shrinking heap, as minmax_heap_sort does
+			Settle();
+			if (!linear_) {
+				for (auto last = Size(); last > 1; --last) {
+					const auto max_index = Sifter{data_, last, compare_}.FindMaxIndex();
+					if (max_index == last - 1) continue;
+					std::swap(data_[max_index], data_[last - 1]);
+					Sifter{data_, static_cast<Index>(last - 1), compare_}.Restore(max_index);
+				}
+			}
 		}
+		return TakeData();
 	}
 
 	void Add(T value) {
+		assert(Size() < Sifter::kMaxIndex);
+
+		if constexpr (Policy::kLazyHeapify) return data_.push_back(std::move(value));
+
+		if (linear_) {
+			if (IsSmall(Size() + 1)) return InsertSorted(std::move(value));
+			data_.push_back(std::move(value));
+			return Heapify();
+		}
+
 		data_.push_back(std::move(value));
-		HeapifyUp(Size() - 1);
+		SiftIn(Size() - 1);
+	}
+
+	// appends a batch of elements and arranges them together, rebuilding the ancestors of a large batch level by
+	// level instead of sifting up each element along its own path
+	template <typename TIterator>
+	void AddRange(TIterator begin, const TIterator& end) {
+		const auto first = Size();
+		for (; begin != end; ++begin) {
+			assert(Size() < Sifter::kMaxIndex);
+			data_.push_back(*begin);
+		}
+		if constexpr (!Policy::kLazyHeapify) {
+			if (Size() > first) FoldAppended(first);
+		}
+	}
+
+	// replaces every element x with function(x), where function must be non-decreasing under the comparator; such a
+	// transform keeps the heap order valid, so the elements are rewritten in place without comparisons or sifts
+	template <typename Function>
+	void TransformAll(Function&& function) {
+		for (auto i = Index{0}; i < Size(); ++i) data_[i] = function(std::as_const(data_[i]));
 	}
 
 	T RemoveMin() {
 		assert(!data_.empty());
-		const auto min_value = data_[0];
-		std::swap(data_[0], data_[Size() - 1]);
+		Settle();
+		if constexpr (Policy::kLazyHeapify) --settled_size_;
+		ShrinkIfSparse();
+
+		if (linear_) {
+			auto min_value = std::move(data_[0]);
+			for (auto i = Index{1}; i < Size(); ++i) data_[i - 1] = std::move(data_[i]);
+			data_.pop_back();
+			max_index_ = Size() - 1;
+			return min_value;
+		}
+
+		const auto last_index = Size() - 1;
+		std::swap(data_[0], data_[last_index]);
+		auto min_value = std::move(data_[last_index]);
 		data_.pop_back();
-		HeapifyDown(0);
+		if (Size() > 0) Sift().Restore(0);
+		// sifting from the root only lets a root child be overwritten by a value that does not exceed the maximum
+		if (max_index_ == last_index) max_index_ = Sift().FindMaxIndex();
+		if (IsSmall(Size(), Policy::kSmallSizeThreshold / 2)) Sort();
 		return min_value;
 	}
 
 	T RemoveMax() {
 		assert(!data_.empty());
-		if (data_.size() <= 2) {
-			const auto max_value = data_[Size() - 1];
+		Settle();
+		if constexpr (Policy::kLazyHeapify) --settled_size_;
+		ShrinkIfSparse();
+		if (linear_) {
+			auto max_value = std::move(data_[max_index_--]);
 			data_.pop_back();
 			return max_value;
 		}
-		const auto left_child = data_[kRootLeftChildIndex];
-		const auto right_child = data_[kRootRightChildIndex];
-		const auto max_index = left_child > right_child ? kRootLeftChildIndex : kRootRightChildIndex;
-		const auto max_value = data_[max_index];
-		std::swap(data_[max_index], data_[Size() - 1]);
+
+		const auto last_index = Size() - 1;
+		std::swap(data_[max_index_], data_[last_index]);
+		auto max_value = std::move(data_[last_index]);
 		data_.pop_back();
-		HeapifyDown(max_index);
+		if (max_index_ < Size()) Sift().Restore(max_index_);
+		max_index_ = Sift().FindMaxIndex();
+		if (IsSmall(Size(), Policy::kSmallSizeThreshold / 2)) Sort();
 		return max_value;
 	}
 
-	[[nodiscard]] const T& Min() const noexcept {
+	[[nodiscard]] const T& Min() const noexcept(!Policy::kLazyHeapify) {
 		assert(!data_.empty());
+		Settle();
 		return data_[0];
 	}
 
-	[[nodiscard]] const T& Max() const noexcept {
+	[[nodiscard]] const T& Max() const noexcept(!Policy::kLazyHeapify) {
 		assert(!data_.empty());
-		if (data_.size() <= 2) {
-			return data_[Size() - 1];
-		}
-		const auto left_child = data_[kRootLeftChildIndex];
-		const auto right_child = data_[kRootRightChildIndex];
-		const auto max_index = left_child > right_child ? kRootLeftChildIndex : kRootRightChildIndex;
-		return data_[max_index];
+		Settle();
+		return data_[max_index_];
 	}
 
-	[[nodiscard]] int Size() const noexcept { return static_cast<int>(data_.size()); }
+	[[nodiscard]] Index Size() const noexcept { return static_cast<Index>(data_.size()); }
 
-private:
-	static bool IsMinLevel(const int index) { return static_cast<int>(std::log2(index + 1)) % 2 == 0; }
-
-	static constexpr int LeftChildIndex(const int index) noexcept { return 2 * index + 1; }
-	static constexpr int RightChildIndex(const int index) noexcept { return 2 * index + 2; }
-	static constexpr int ParentIndex(const int index) noexcept { return (index - 1) / 2; }
+	[[nodiscard]] Index Capacity() const noexcept { return static_cast<Index>(data_.capacity()); }
 
-	static constexpr bool HasParent(const int index) noexcept { return index > 0; }
-	[[nodiscard]] bool HasLeftChild(const int index) const noexcept { return LeftChildIndex(index) < Size(); }
-	[[nodiscard]] bool HasRightChild(const int index) const noexcept { return RightChildIndex(index) < Size(); }
+	void Reserve(const Index capacity) { data_.reserve(capacity); }
 
-	[[nodiscard]] std::vector<int> GetChildren(const int index) const {
-		std::vector<int> children;
+	// removes all elements but keeps the capacity so that a heap reused across batches does not regrow from zero
+	void Clear() noexcept {
+		data_.clear();
+		max_index_ = static_cast<Index>(-1);
+		linear_ = IsSmall(0);
+		settled_size_ = 0;
+		sparse_pops_ = 0;
+	}
 
-		if (HasLeftChild(index)) {
-			children.push_back(LeftChildIndex(index));
+	void ShrinkToFit() { data_.shrink_to_fit(); }
 
-			if (HasRightChild(index)) {
-				children.push_back(RightChildIndex(index));
-			}
-		}
+private:
+	[[nodiscard]] Sifter Sift() const noexcept { return Sifter{data_, Size(), compare_}; }
 
-		return children;
+	[[nodiscard]] Storage TakeData() {
+		auto data = std::move(data_);
+		Clear();
+		return data;
 	}
 
-	[[nodiscard]] std::vector<int> GetDescendants(const int index) const {
-		std::vector<int> descendants;
-
-		for (const auto child : GetChildren(index)) {
-			descendants.push_back(child);
+	// sifts the element at index, the first one past the heap ordered prefix, up into that prefix
+	void SiftIn(const Index index) const {
+		// a strictly greater value climbs the max levels all the way to the root child above its leaf
+		const auto is_new_max = index == 0 || compare_(data_[max_index_], data_[index]);
+		Sifter{data_, static_cast<Index>(index + 1), compare_}.HeapifyUp(index);
+		if (index <= 1) max_index_ = index;
+		else if (is_new_max) max_index_ = Sifter::AncestorIndex(index, Sifter::Level(index) - 1);
+	}
 
-			for (const auto grandchild : GetChildren(child)) {
-				descendants.push_back(grandchild);
-			}
+	// folds the elements appended to a lazy heap since its last query into the heap order
+	void Settle() const {
+		if constexpr (Policy::kLazyHeapify) {
+			if (settled_size_ == Size()) return;
+			FoldAppended(settled_size_);
+			settled_size_ = Size();
 		}
-
-		return descendants;
 	}
 
-	void HeapifyDown(const int index) {
-		return IsMinLevel(index) ? HeapifyDown(index, kLessComparator) : HeapifyDown(index, kGreaterComparator);
+	// arranges the elements from index first on, which were appended to a heap of the elements before it
+	void FoldAppended(const Index first) const {
+		const auto size = Size();
+		// sifting up costs at most a path to the root per element, while rebuilding the ancestors of the appended
+		// elements visits about two nodes per element plus a path per level
+		if (linear_ || first == 0) {
+			Build();
+		} else if (size - first < static_cast<Index>(Sifter::Level(size - 1))) {
+			for (auto i = first; i < size; ++i) SiftIn(i);
+		} else {
+			Sift().HeapifyAppended(first);
+			max_index_ = Sift().FindMaxIndex();
+		}
 	}
 
-	template <typename Comparator>
-	void HeapifyDown(const int index, const Comparator& comparator) {
-
-		const auto descendants = GetDescendants(index);
-		if (descendants.empty()) return;
-
-		const auto extremum = *std::min_element(
-			std::cbegin(descendants), std::cend(descendants), [this, &comparator](const auto i, const auto j) {
-				return comparator(data_[i], data_[j]);
-			});
-
-		if (extremum > RightChildIndex(index)) {
-			if (comparator(data_[extremum], data_[index])) {
-				std::swap(data_[extremum], data_[index]);
-
-				if (!comparator(data_[extremum], data_[ParentIndex(extremum)])) {
-					std::swap(data_[extremum], data_[ParentIndex(extremum)]);
-				}
+	static constexpr bool IsSmall(const Index size, const int threshold = Policy::kSmallSizeThreshold) noexcept {
+		return Policy::kSmallSizeThreshold > 0 && size <= static_cast<Index>(threshold);
+	}
 
-				HeapifyDown(extremum, comparator);
-			}
-		} else if (comparator(data_[extremum], data_[index])) {
-			std::swap(data_[extremum], data_[index]);
-		}
+	// sorted ascending order is the linear representation of a small heap, with the maximum at the back
+	void Sort() const {
+		for (auto i = Index{1}; i < Size(); ++i) ShiftIntoSortedPrefix(i);
+		max_index_ = Size() - 1;
+		linear_ = true;
 	}
 
-	void HeapifyUp(const int index) {
+	void InsertSorted(T value) {
+		data_.push_back(std::move(value));
+		ShiftIntoSortedPrefix(Size() - 1);
+		max_index_ = Size() - 1;
+	}
 
-		if (!HasParent(index)) return;
+	// moves the element at index back past every larger element of the sorted range before it
+	void ShiftIntoSortedPrefix(const Index index) const {
+		auto value = std::move(data_[index]);
+		auto hole = index;
+		for (; hole > 0 && compare_(value, data_[hole - 1]); --hole) data_[hole] = std::move(data_[hole - 1]);
+		data_[hole] = std::move(value);
+	}
 
-		if (IsMinLevel(index)) {
-			if (data_[index] > data_[ParentIndex(index)]) {
-				std::swap(data_[index], data_[ParentIndex(index)]);
-				HeapifyUp(ParentIndex(index), kGreaterComparator);
-			} else {
-				HeapifyUp(index, kLessComparator);
-			}
+	void Build() const {
+		if (IsSmall(Size())) {
+			Sort();
 		} else {
-			if (data_[index] < data_[ParentIndex(index)]) {
-				std::swap(data_[index], data_[ParentIndex(index)]);
-				HeapifyUp(ParentIndex(index), kLessComparator);
-			} else {
-				HeapifyUp(index, kGreaterComparator);
-			}
+			Heapify();
 		}
 	}
 
-	template <typename Comparator>
-	void HeapifyUp(const int index, const Comparator& comparator) {
-
-		if (HasParent(index) && HasParent(ParentIndex(index))) {
-			const auto grandparent = ParentIndex(ParentIndex(index));
-
-			if (comparator(data_[index], data_[grandparent])) {
-				std::swap(data_[index], data_[grandparent]);
-				HeapifyUp(grandparent, comparator);
+	void ShrinkIfSparse() {
+		if constexpr (Policy::kShrinkAfterPops > 0) {
+			if (static_cast<std::size_t>(Size()) * 4 >= data_.capacity()) {
+				sparse_pops_ = 0;
+			} else if (++sparse_pops_ == Policy::kShrinkAfterPops) {
+				sparse_pops_ = 0;
+				decltype(data_) data;
+				data.reserve(data_.capacity() / 2);
+				// a storage that allocates in coarser steps than single elements, like BlockedStorage, may only
+				// shrink when asked for less, and is left alone if that does not help either
+				if (data.capacity() >= data_.capacity()) {
+					data = decltype(data_){};
+					data.reserve(static_cast<std::size_t>(Size()) * 2);
+					if (data.capacity() >= data_.capacity()) return;
+				}
+				for (auto i = Index{0}; i < Size(); ++i) data.push_back(std::move(data_[i]));
+				data_ = std::move(data);
 			}
 		}
 	}
 
-	static constexpr auto kRootLeftChildIndex = LeftChildIndex(0);
-	static constexpr auto kRootRightChildIndex = RightChildIndex(0);
-	static constexpr auto kLessComparator = std::less<T>{};
-	static constexpr auto kGreaterComparator = std::greater<T>{};
-	std::vector<T> data_;
+	void Heapify() const {
+		Sift().Heapify();
+		max_index_ = Sift().FindMaxIndex();
+		linear_ = false;
+	}
+
+	// the first query of a lazy heap arranges the elements, which const queries may do too
+	mutable Storage data_;
+	Compare compare_;
+	mutable Index max_index_ = static_cast<Index>(-1);
+	mutable bool linear_ = Policy::kSmallSizeThreshold > 0;
+	mutable Index settled_size_ = 0;
+	int sparse_pops_ = 0;
 };
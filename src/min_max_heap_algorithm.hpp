@@ -0,0 +1,573 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "bits.hpp"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+// Specialize for key types whose comparisons are cheap and side effect free to let the heap evaluate them
+// unconditionally and select indices with arithmetic instead of branches.
+template <typename T>
+struct IsCheaplyComparable : std::is_arithmetic<T> {};
+
+// Compile-time tuning knobs. Derive from this struct and override the members to customize a heap.
+struct MinMaxHeapPolicy {
+	// prefetch the grandchildren of the next level's candidates in HeapifyDown, which pays off once the heap
+	// no longer fits in cache; only binary heaps prefetch since wider heaps already read whole cache lines
+	static constexpr bool kPrefetch = false;
+
+	// number of children per node, a power of two; wider heaps are shallower but compare more per level
+	static constexpr int kArity = 2;
+
+	// after removing an extremum, move the hole down to a leaf comparing descendants only and then sift the
+	// displaced element up from there, which saves comparisons when they are expensive
+	static constexpr bool kLeafPathRemoval = false;
+
+	// find how far an added element climbs with a binary search over its grandparents, which takes O(log log n)
+	// comparisons instead of O(log n) when comparisons are expensive
+	static constexpr bool kBinarySearchInsertion = false;
+
+	// heaps of at most this many elements keep them sorted in place, where an insertion or removal is a short
+	// linear shift instead of a sift; a heap demotes back to sorted order once it shrinks to half the threshold
+	static constexpr int kSmallSizeThreshold = 16;
+
+	// integral type of positions and of Size(); std::uint32_t keeps index arithmetic narrow for hot heaps, while
+	// std::size_t admits heaps of more than 2^32 elements
+	using IndexType = int;
+
+	// release half of the capacity once this many removals in a row found the heap using less than a quarter of
+	// it, so a heap that spiked once does not hold on to its peak memory; 0 never releases capacity on its own
+	static constexpr int kShrinkAfterPops = 0;
+
+	// number of threads that build large heaps bottom-up, each heapifying its own block of subtrees before the
+	// levels above them are finished serially; 0 uses one thread per hardware thread. With more than one thread the
+	// comparator is called concurrently and must be safe to call so; an exception it throws is rethrown once every
+	// thread is done, and blocks for which no thread can be created are heapified on the calling thread
+	static constexpr int kBuildThreads = 1;
+
+	// construction and Add only append while the heap is lazy, and the first query after a burst of appends folds
+	// them in, by sifting each one up or by rebuilding the whole heap, whichever bounds the work lower; queries then
+	// modify the heap, so concurrent const access needs external synchronization
+	static constexpr bool kLazyHeapify = false;
+
+	// level-order container backing the heap, e.g. CacheLineBlockedStorage to keep subtrees within a cache line
+	template <typename U>
+	using Storage = std::vector<U>;
+};
+
+namespace min_max_heap_detail {
+
+// The sift operations of a min-max heap over the first size elements of Elements, which is either a random
+// access iterator or a reference to a container with operator[]. Ordering is given by a less-than comparator, and
+// the layout and sifting strategy by the arity, prefetching, leaf path and binary search members of Policy.
+template <typename T, typename Policy, typename Elements, typename Compare>
+class Sifter {
+	static_assert(Policy::kArity >= 2 && bits::IsPowerOfTwo(Policy::kArity));
+	static_assert(std::is_integral_v<typename Policy::IndexType>);
+
+public:
+	using Index = typename Policy::IndexType;
+
+	Sifter(Elements elements, const Index size, const Compare& compare) noexcept
+		: elements_(elements), size_{size}, less_{compare}, greater_{compare} {}
+
+	static constexpr auto kMaxIndex = std::numeric_limits<Index>::max();
+
+	static int Level(const Index index) noexcept {
+		return bits::FloorLog2(static_cast<std::uint64_t>(kArity - 1) * index + 1) / kLog2Arity;
+	}
+
+	static bool IsMinLevel(const Index index) noexcept { return Level(index) % 2 == 0; }
+
+	// child positions saturate at kMaxIndex instead of wrapping around, which is never a valid position since the
+	// size stays below it
+	static constexpr Index FirstChildIndex(const Index index) noexcept {
+		return index <= (kMaxIndex - 1) / kArity ? kArity * index + 1 : kMaxIndex;
+	}
+
+	static constexpr Index LastChildIndex(const Index index) noexcept {
+		return index <= (kMaxIndex - kArity) / kArity ? kArity * index + kArity : kMaxIndex;
+	}
+
+	static constexpr Index FirstGrandchildIndex(const Index index) noexcept { return FirstChildIndex(FirstChildIndex(index)); }
+	static constexpr Index LastGrandchildIndex(const Index index) noexcept { return LastChildIndex(LastChildIndex(index)); }
+	static constexpr Index ParentIndex(const Index index) noexcept { return (index - 1) / kArity; }
+
+	// the ancestor the given number of levels above index, which must not exceed the level of index
+	static constexpr Index AncestorIndex(const Index index, const int levels) noexcept {
+		const auto first_index_of_level = ((std::uint64_t{1} << levels * kLog2Arity) - 1) / (kArity - 1);
+		return static_cast<Index>((static_cast<std::uint64_t>(index) - first_index_of_level) >> levels * kLog2Arity);
+	}
+
+	static constexpr bool HasParent(const Index index) noexcept { return index > 0; }
+	static constexpr bool HasGrandparent(const Index index) noexcept { return index > kArity; }
+
+	void Heapify() {
+		const auto internal_nodes = size_ > 1 ? ParentIndex(size_ - 1) + 1 : 0;
+		auto serial_nodes = internal_nodes;
+
+		if constexpr (Policy::kBuildThreads != 1) {
+			const auto threads = Policy::kBuildThreads > 0
+									 ? static_cast<unsigned>(Policy::kBuildThreads)
+									 : std::max(1u, std::thread::hardware_concurrency());
+			if (threads > 1 && static_cast<std::uint64_t>(size_) / threads >= kMinParallelBuildSizePerThread) {
+				serial_nodes = HeapifySubtreesInParallel(threads, internal_nodes);
+			}
+		}
+
+		// counts down past zero without going negative so that unsigned index types work too
+		for (auto i = serial_nodes; i-- > 0;) {
+			HeapifyDown(i);
+		}
+	}
+
+	// Restores the heap order after the elements from first on were appended to a min-max heap of the elements
+	// before first. Only the ancestors of the appended elements are heapified, from the bottom up, which takes
+	// O(k + log^2 n) for k appended elements instead of O(n) for a full rebuild.
+	void HeapifyAppended(const Index first) {
+		if (first == 0) return Heapify();
+		auto low = ParentIndex(first);
+		auto high = ParentIndex(size_ - 1);
+		for (;;) {
+			for (auto i = high + 1; i-- > low;) HeapifyDown(i);
+			if (low == 0) return;
+			// the parents of a range that spans two levels overlap its lower end, which is already heapified
+			high = std::min(ParentIndex(high), static_cast<Index>(low - 1));
+			low = ParentIndex(low);
+		}
+	}
+
+	[[nodiscard]] Index FindMaxIndex() const {
+		if (size_ <= 2) return size_ - 1;
+
+		auto max_index = FirstChildIndex(0);
+		for (auto i = max_index + 1; i <= LastChildIndex(0) && i < size_; ++i) {
+			if (greater_(elements_[i], elements_[max_index])) max_index = i;
+		}
+		return max_index;
+	}
+
+	// restores the heap order after the element at index was replaced, typically by the former last element
+	void Restore(const Index index) {
+		if constexpr (Policy::kLeafPathRemoval) {
+			return IsMinLevel(index) ? HeapifyDownLeafPath(index, less_) : HeapifyDownLeafPath(index, greater_);
+		} else {
+			HeapifyDown(index);
+		}
+	}
+
+	// the first position whose element is out of order with its parent or grandparent, or the size if none is
+	[[nodiscard]] Index FindFirstViolation() const {
+		for (auto i = Index{1}; i < size_; ++i) {
+			const auto parent = ParentIndex(i);
+			const auto min_level = IsMinLevel(i);
+			if (min_level ? less_(elements_[parent], elements_[i]) : less_(elements_[i], elements_[parent])) return i;
+
+			if (HasGrandparent(i)) {
+				const auto grandparent = ParentIndex(parent);
+				if (min_level ? less_(elements_[i], elements_[grandparent]) : less_(elements_[grandparent], elements_[i])) {
+					return i;
+				}
+			}
+		}
+		return size_;
+	}
+
+	void HeapifyUp(const Index index) {
+
+		if (!HasParent(index)) return;
+
+		if constexpr (IsCheaplyComparable<T>::value && !Policy::kBinarySearchInsertion) {
+			const auto parent = ParentIndex(index);
+			const auto min_level = IsMinLevel(index);
+			const auto swap = less_(elements_[min_level ? parent : index], elements_[min_level ? index : parent]);
+			SwapIf(swap, index, parent);
+
+			const auto towards_min = min_level != swap;
+			for (auto i = index + (parent - index) * swap; HasGrandparent(i);) {
+				const auto grandparent = ParentIndex(ParentIndex(i));
+				if (!less_(elements_[towards_min ? i : grandparent], elements_[towards_min ? grandparent : i])) break;
+				std::swap(elements_[i], elements_[grandparent]);
+				i = grandparent;
+			}
+		} else if (IsMinLevel(index)) {
+			if (greater_(elements_[index], elements_[ParentIndex(index)])) {
+				std::swap(elements_[index], elements_[ParentIndex(index)]);
+				HeapifyUp(ParentIndex(index), greater_);
+			} else {
+				HeapifyUp(index, less_);
+			}
+		} else {
+			if (less_(elements_[index], elements_[ParentIndex(index)])) {
+				std::swap(elements_[index], elements_[ParentIndex(index)]);
+				HeapifyUp(ParentIndex(index), less_);
+			} else {
+				HeapifyUp(index, greater_);
+			}
+		}
+	}
+
+private:
+	// Heapifies the subtrees rooted at the highest level with a few of them per thread. Each thread takes a
+	// contiguous block of roots, whose descendants on every level below are contiguous too, and heapifies it level
+	// by level from the bottom. Returns the number of nodes above the roots, which are left to the caller.
+	Index HeapifySubtreesInParallel(const unsigned threads, const Index internal_nodes) {
+		auto level = 0;
+		while ((std::uint64_t{1} << level * kLog2Arity) < std::uint64_t{threads} * kSubtreesPerThread) ++level;
+
+		const auto first_root = static_cast<Index>(((std::uint64_t{1} << level * kLog2Arity) - 1) / (kArity - 1));
+		if (first_root >= internal_nodes) return internal_nodes;
+
+		const auto roots = std::min<std::uint64_t>(std::uint64_t{1} << level * kLog2Arity, internal_nodes - first_root);
+		const auto roots_per_thread = (roots + threads - 1) / threads;
+
+		const auto heapify_block = [this, internal_nodes](Index first, Index last) {
+			std::vector<std::pair<Index, Index>> levels;
+			for (; first < internal_nodes; first = FirstChildIndex(first), last = LastChildIndex(last)) {
+				levels.emplace_back(first, std::min<Index>(last, internal_nodes - 1));
+			}
+			for (auto level = levels.crbegin(); level != levels.crend(); ++level) {
+				for (auto i = level->second + 1; i-- > level->first;) HeapifyDown(i);
+			}
+		};
+
+		// an exception thrown by the comparator is held until every block is done and then rethrown, as the serial
+		// build would throw it
+		const auto blocks = static_cast<std::size_t>((roots + roots_per_thread - 1) / roots_per_thread);
+		std::vector<std::exception_ptr> errors(blocks);
+		const auto run_block = [&](const std::size_t block) {
+			const auto first = first_root + block * roots_per_thread;
+			const auto last = first_root + std::min((block + 1) * roots_per_thread, roots) - 1;
+			try {
+				heapify_block(static_cast<Index>(first), static_cast<Index>(last));
+			} catch (...) {
+				errors[block] = std::current_exception();
+			}
+		};
+
+		{
+			// joins the started threads on every path out of the scope, since destroying a joinable thread terminates
+			struct Workers {
+				~Workers() {
+					for (auto& thread : threads) thread.join();
+				}
+				std::vector<std::thread> threads;
+			} workers;
+			workers.threads.reserve(blocks);
+
+			auto block = std::size_t{0};
+			for (; block < blocks; ++block) {
+				try {
+					workers.threads.emplace_back(run_block, block);
+				} catch (const std::system_error&) {
+					break;
+				}
+			}
+			// the blocks that no thread could be created for are heapified on the calling thread
+			for (; block < blocks; ++block) run_block(block);
+		}
+
+		for (const auto& error : errors) {
+			if (error) std::rethrow_exception(error);
+		}
+		return first_root;
+	}
+
+	// orders by the reverse of the comparator, which is what the max levels are heap ordered by
+	struct Greater {
+		template <typename A, typename B>
+		bool operator()(const A& a, const B& b) const {
+			return compare(b, a);
+		}
+
+		const Compare& compare;
+	};
+
+	// the children of index followed by its grandchildren, which are contiguous in level order; returns index
+	// itself when it is a leaf
+	template <typename Comparator>
+	[[nodiscard]] Index DescendantExtremum(const Index index, const Comparator& comparator) const {
+		auto extremum = index;
+
+		for (auto child = FirstChildIndex(index); child <= LastChildIndex(index) && child < size_; ++child) {
+			if (extremum == index || comparator(elements_[child], elements_[extremum])) extremum = child;
+		}
+
+		for (auto grandchild = FirstGrandchildIndex(index);
+			 grandchild <= LastGrandchildIndex(index) && grandchild < size_; ++grandchild) {
+			if (comparator(elements_[grandchild], elements_[extremum])) extremum = grandchild;
+		}
+
+		return extremum;
+	}
+
+	void HeapifyDown(const Index index) {
+		return IsMinLevel(index) ? HeapifyDown(index, less_) : HeapifyDown(index, greater_);
+	}
+
+	template <typename Comparator>
+	void HeapifyDown(Index index, const Comparator& comparator) {
+
+		if constexpr (IsCheaplyComparable<T>::value) {
+			// while all grandchildren exist, the extremum of the descendants is always one of them
+			for (auto grandchild = FirstGrandchildIndex(index); LastGrandchildIndex(index) < size_;
+				 grandchild = FirstGrandchildIndex(index)) {
+
+				if constexpr (Policy::kPrefetch && kArity == 2) PrefetchGrandchildren(grandchild);
+
+				const auto extremum = SelectExtremum<kGrandchildCount>(grandchild, comparator);
+
+				if (!comparator(elements_[extremum], elements_[index])) return;
+
+				std::swap(elements_[extremum], elements_[index]);
+				SwapIf(!comparator(elements_[extremum], elements_[ParentIndex(extremum)]), extremum, ParentIndex(extremum));
+				index = extremum;
+			}
+		}
+
+		if constexpr (Policy::kPrefetch && kArity == 2) PrefetchGrandchildren(FirstGrandchildIndex(index));
+
+		const auto extremum = DescendantExtremum(index, comparator);
+		if (extremum == index) return;
+
+		if (extremum > LastChildIndex(index)) {
+			if (comparator(elements_[extremum], elements_[index])) {
+				std::swap(elements_[extremum], elements_[index]);
+
+				if (!comparator(elements_[extremum], elements_[ParentIndex(extremum)])) {
+					std::swap(elements_[extremum], elements_[ParentIndex(extremum)]);
+				}
+
+				HeapifyDown(extremum, comparator);
+			}
+		} else if (comparator(elements_[extremum], elements_[index])) {
+			std::swap(elements_[extremum], elements_[index]);
+		}
+	}
+
+	// The displaced element at index almost always sinks back to the bottom, so rather than comparing against it
+	// on every level, promote the extremum of the leaf-or-grandchild descendants into the hole until it reaches
+	// a leaf, then let the element climb back up from there.
+	template <typename Comparator>
+	void HeapifyDownLeafPath(Index index, const Comparator& comparator) {
+		auto value = std::move(elements_[index]);
+
+		while (true) {
+			auto extremum = index;
+
+			for (auto grandchild = FirstGrandchildIndex(index);
+				 grandchild <= LastGrandchildIndex(index) && grandchild < size_; ++grandchild) {
+				if (extremum == index || comparator(elements_[grandchild], elements_[extremum])) extremum = grandchild;
+			}
+
+			// a child on the opposite level bounds its own descendants, so only a childless one can be the extremum
+			const auto first_childless = std::max(FirstChildIndex(index), static_cast<Index>(ParentIndex(size_ - 1) + 1));
+			for (auto child = first_childless; child <= LastChildIndex(index) && child < size_; ++child) {
+				if (extremum == index || comparator(elements_[child], elements_[extremum])) extremum = child;
+			}
+
+			if (extremum == index) break;
+
+			elements_[index] = std::move(elements_[extremum]);
+			index = extremum;
+		}
+
+		elements_[index] = std::move(value);
+		HeapifyUp(index);
+	}
+
+	template <typename Comparator>
+	void HeapifyUp(const Index index, const Comparator& comparator) {
+
+		if constexpr (Policy::kBinarySearchInsertion) {
+			// the grandparents above index form a sorted chain, so the number of them the element passes is
+			// found with a binary search and only the data movement is linear
+			auto low = 0;
+			for (auto high = Level(index) / 2; low < high;) {
+				const auto middle = (low + high + 1) / 2;
+				if (comparator(elements_[index], elements_[AncestorIndex(index, 2 * middle)])) {
+					low = middle;
+				} else {
+					high = middle - 1;
+				}
+			}
+
+			if (low == 0) return;
+
+			auto value = std::move(elements_[index]);
+			auto hole = index;
+			for (auto step = 1; step <= low; ++step) {
+				const auto ancestor = AncestorIndex(index, 2 * step);
+				elements_[hole] = std::move(elements_[ancestor]);
+				hole = ancestor;
+			}
+			elements_[hole] = std::move(value);
+		} else if (HasGrandparent(index)) {
+			const auto grandparent = ParentIndex(ParentIndex(index));
+
+			if (comparator(elements_[index], elements_[grandparent])) {
+				std::swap(elements_[index], elements_[grandparent]);
+				HeapifyUp(grandparent, comparator);
+			}
+		}
+	}
+
+	// selects the extremum among Count consecutive elements with a tournament whose outcome is computed with
+	// index arithmetic, so no branch depends on the comparison results
+	template <int Count, typename Comparator>
+	[[nodiscard]] Index SelectExtremum(const Index first, const Comparator& comparator) const {
+		if constexpr (Count == 1) {
+			return first;
+		} else {
+			const auto a = SelectExtremum<Count / 2>(first, comparator);
+			const auto b = SelectExtremum<Count / 2>(first + Count / 2, comparator);
+			return a + (b - a) * comparator(elements_[b], elements_[a]);
+		}
+	}
+
+	// prefetches the grandchildren of the four grandchildren starting at the given index, i.e. the block of
+	// candidates the next HeapifyDown step will select from
+	void PrefetchGrandchildren(const Index grandchild) const noexcept {
+		const auto first = FirstGrandchildIndex(grandchild);
+		if (first >= size_) return;
+
+		auto previous_line = std::uintptr_t{0};
+		for (auto i = first; i < first + std::min<Index>(16, size_ - first); ++i) {
+			const auto* const address = reinterpret_cast<const char*>(&elements_[i]);
+			const auto line = reinterpret_cast<std::uintptr_t>(address) / kCacheLineSize;
+			if (line != previous_line) {
+				Prefetch(address);
+				previous_line = line;
+			}
+		}
+	}
+
+	static void Prefetch([[maybe_unused]] const char* const address) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch(address);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+		_mm_prefetch(address, _MM_HINT_T0);
+#endif
+	}
+
+	void SwapIf(const bool condition, const Index i, const Index j) {
+		const T a = elements_[i];
+		const T b = elements_[j];
+		elements_[i] = condition ? b : a;
+		elements_[j] = condition ? a : b;
+	}
+
+	static constexpr auto kArity = Policy::kArity;
+	static constexpr auto kLog2Arity = bits::Log2(kArity);
+	static constexpr auto kGrandchildCount = kArity * kArity;
+	static constexpr auto kCacheLineSize = 64;
+	static constexpr auto kSubtreesPerThread = 4;
+	static constexpr auto kMinParallelBuildSizePerThread = 1 << 14;
+	Elements elements_;
+	Index size_;
+	const Compare& less_;
+	Greater greater_;
+};
+
+template <typename Policy, typename RandomIt, typename Compare>
+auto MakeSifter(const RandomIt first, const RandomIt last, const Compare& compare) {
+	using T = typename std::iterator_traits<RandomIt>::value_type;
+	using Index = typename Policy::IndexType;
+	return Sifter<T, Policy, RandomIt, Compare>{first, static_cast<Index>(last - first), compare};
+}
+}
+
+// Algorithms in the style of std::make_heap over a random access range [first, last) that is ordered by a
+// less-than comparator. Policy selects the arity and sifting strategy and must be the same for every call on a
+// range; the small size threshold, storage and shrink members only apply to MinMaxHeap.
+
+// arranges the range into a min-max heap in O(n)
+template <typename Policy = MinMaxHeapPolicy, typename RandomIt, typename Compare = std::less<>>
+void make_minmax_heap(const RandomIt first, const RandomIt last, const Compare& compare = {}) {
+	min_max_heap_detail::MakeSifter<Policy>(first, last, compare).Heapify();
+}
+
+// adds the element at last - 1 to the min-max heap [first, last - 1)
+template <typename Policy = MinMaxHeapPolicy, typename RandomIt, typename Compare = std::less<>>
+void push_minmax_heap(const RandomIt first, const RandomIt last, const Compare& compare = {}) {
+	assert(first != last);
+	auto sifter = min_max_heap_detail::MakeSifter<Policy>(first, last, compare);
+	sifter.HeapifyUp(static_cast<typename Policy::IndexType>(last - first - 1));
+}
+
+// moves the minimum to last - 1 and leaves [first, last - 1) a min-max heap
+template <typename Policy = MinMaxHeapPolicy, typename RandomIt, typename Compare = std::less<>>
+void pop_minmax_min(const RandomIt first, const RandomIt last, const Compare& compare = {}) {
+	assert(first != last);
+	if (last - first == 1) return;
+	std::iter_swap(first, last - 1);
+	min_max_heap_detail::MakeSifter<Policy>(first, last - 1, compare).Restore(0);
+}
+
+// moves the maximum to last - 1 and leaves [first, last - 1) a min-max heap
+template <typename Policy = MinMaxHeapPolicy, typename RandomIt, typename Compare = std::less<>>
+void pop_minmax_max(const RandomIt first, const RandomIt last, const Compare& compare = {}) {
+	assert(first != last);
+	const auto max_index = min_max_heap_detail::MakeSifter<Policy>(first, last, compare).FindMaxIndex();
+	if (first + max_index == last - 1) return;
+	std::iter_swap(first + max_index, last - 1);
+	min_max_heap_detail::MakeSifter<Policy>(first, last - 1, compare).Restore(max_index);
+}
+
+// the end of the longest prefix of [first, last) that is a min-max heap
+template <typename Policy = MinMaxHeapPolicy, typename RandomIt, typename Compare = std::less<>>
+[[nodiscard]] RandomIt is_minmax_heap_until(const RandomIt first, const RandomIt last, const Compare& compare = {}) {
+	return first + min_max_heap_detail::MakeSifter<Policy>(first, last, compare).FindFirstViolation();
+}
+
+template <typename Policy = MinMaxHeapPolicy, typename RandomIt, typename Compare = std::less<>>
+[[nodiscard]] bool is_minmax_heap(const RandomIt first, const RandomIt last, const Compare& compare = {}) {
+	return is_minmax_heap_until<Policy>(first, last, compare) == last;
+}
+
+// sorts the range in ascending order in place by arranging it into a min-max heap and repeatedly moving the
+// maximum behind the shrinking heap
+template <typename Policy = MinMaxHeapPolicy, typename RandomIt, typename Compare = std::less<>>
+void minmax_heap_sort(const RandomIt first, RandomIt last, const Compare& compare = {}) {
+	make_minmax_heap<Policy>(first, last, compare);
+	for (; last - first > 1; --last) pop_minmax_max<Policy>(first, last, compare);
+}
+
+// moves the low smallest elements to the front and the high largest elements to the back of the range, both in
+// ascending order, from a single min-max heap built over the whole range in O(n); the order of the elements in
+// between is unspecified
+template <typename Policy = MinMaxHeapPolicy, typename RandomIt, typename Compare = std::less<>>
+void minmax_partial_sort_both_ends(const RandomIt first, const RandomIt last,
+	const typename std::iterator_traits<RandomIt>::difference_type low,
+	const typename std::iterator_traits<RandomIt>::difference_type high, const Compare& compare = {}) {
+
+	assert(low >= 0 && high >= 0 && low + high <= last - first);
+	make_minmax_heap<Policy>(first, last, compare);
+
+	auto heap_last = last;
+	for (auto i = high; i > 0; --i) pop_minmax_max<Policy>(first, heap_last--, compare);
+
+	// the minima collect behind the heap in descending order, so they are moved to the front and reversed
+	for (auto i = low; i > 0; --i) pop_minmax_min<Policy>(first, heap_last--, compare);
+	if (heap_last - first >= low) {
+		std::swap_ranges(heap_last, heap_last + low, first);
+	} else {
+		std::rotate(first, heap_last, heap_last + low);
+	}
+	std::reverse(first, first + low);
+}
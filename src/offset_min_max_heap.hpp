@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cassert>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "min_max_heap.hpp"
+
+// A MinMaxHeap of numbers with a global offset that every element is read through. Adding the same delta to all
+// elements preserves their order, so ShiftAll only adjusts the offset in O(1) instead of rewriting the heap; elements
+// are stored relative to the offset and converted on the way in and out. The comparator must be invariant under
+// translation, as std::less and std::greater are. With floating point elements, a large accumulated offset costs
+// precision, which Rebase restores by folding the offset into the elements. With integer elements, a shift or an
+// addition that would take the offset or a stored element out of the range of T rebases first, in O(n); the
+// elements themselves, read through the offset, must stay within that range.
+template <typename T, typename Policy = MinMaxHeapPolicy, typename Compare = std::less<T>>
+class OffsetMinMaxHeap {
+	// unsigned elements would wrap around below the offset and lose their order
+	static_assert(std::is_arithmetic_v<T> && std::is_signed_v<T>);
+	using Index = typename Policy::IndexType;
+
+public:
+	OffsetMinMaxHeap(std::initializer_list<T> data = {}, const Compare& compare = Compare{})
+		: heap_{data, compare} {}
+
+	template <typename TIterator>
+	OffsetMinMaxHeap(const TIterator& begin, const TIterator& end, const Compare& compare = Compare{})
+		: heap_{begin, end, compare} {}
+
+	void Add(const T value) {
+		if (!CanSubtract(value, offset_)) Rebase();
+		heap_.Add(static_cast<T>(value - offset_));
+	}
+
+	T RemoveMin() {
+		assert(Size() > 0);
+		return heap_.RemoveMin() + offset_;
+	}
+
+	T RemoveMax() {
+		assert(Size() > 0);
+		return heap_.RemoveMax() + offset_;
+	}
+
+	[[nodiscard]] T Min() const {
+		assert(Size() > 0);
+		return heap_.Min() + offset_;
+	}
+
+	[[nodiscard]] T Max() const {
+		assert(Size() > 0);
+		return heap_.Max() + offset_;
+	}
+
+	[[nodiscard]] Index Size() const noexcept { return heap_.Size(); }
+
+	// adds delta to every element in O(1), unless an integer offset has to be rebased first
+	void ShiftAll(const T delta) {
+		if (!CanAdd(offset_, delta)) Rebase();
+		offset_ = static_cast<T>(offset_ + delta);
+	}
+
+	// replaces every element x with function(x) for a non-decreasing function in O(n), without comparisons
+	template <typename Function>
+	void TransformAll(Function&& function) {
+		heap_.TransformAll([&function, offset = offset_](const T value) { return function(value + offset); });
+		offset_ = T{0};
+	}
+
+	// folds the offset into the elements
+	void Rebase() {
+		TransformAll([](const T value) { return value; });
+	}
+
+private:
+	// floating point arithmetic saturates at infinity rather than being undefined, so only integers are checked
+	static bool CanAdd(const T a, const T b) noexcept {
+		if constexpr (std::is_integral_v<T>) {
+			return b >= 0 ? a <= std::numeric_limits<T>::max() - b : a >= std::numeric_limits<T>::min() - b;
+		} else {
+			return true;
+		}
+	}
+
+	static bool CanSubtract(const T a, const T b) noexcept {
+		if constexpr (std::is_integral_v<T>) {
+			return b >= 0 ? a >= std::numeric_limits<T>::min() + b : a <= std::numeric_limits<T>::max() + b;
+		} else {
+			return true;
+		}
+	}
+
+	MinMaxHeap<T, Policy, Compare> heap_;
+	T offset_ = T{0};
+};
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "min_max_heap.hpp"
+
+// A double-ended priority queue for many entries over few distinct keys. The MinMaxHeap holds every distinct key
+// once, and a hash index beside it counts how often each key was added, so memory and the cost of a sift scale with
+// the distinct keys rather than with the entries. Adding a present key or removing one of several copies only
+// changes its count. Keys that are neither less than the other under Compare must also be equal under KeyEqual.
+template <typename T, typename Policy = MinMaxHeapPolicy, typename Compare = std::less<T>,
+	typename Hash = std::hash<T>, typename KeyEqual = std::equal_to<T>>
+class RunLengthMinMaxHeap {
+	using Heap = MinMaxHeap<T, Policy, Compare>;
+
+public:
+	using Count = std::uint64_t;
+
+	RunLengthMinMaxHeap(std::initializer_list<T> data = {}, const Compare& compare = Compare{})
+		: RunLengthMinMaxHeap{std::cbegin(data), std::cend(data), compare} {}
+
+	template <typename TIterator>
+	RunLengthMinMaxHeap(TIterator begin, const TIterator& end, const Compare& compare = Compare{})
+		: heap_{std::initializer_list<T>{}, compare} {
+		for (; begin != end; ++begin, ++size_) ++counts_[*begin];
+
+		// the distinct keys are heapified once instead of being sifted in one at a time
+		std::vector<T> keys;
+		keys.reserve(counts_.size());
+		for (const auto& entry : counts_) keys.push_back(entry.first);
+		heap_.AddRange(std::make_move_iterator(keys.begin()), std::make_move_iterator(keys.end()));
+	}
+
+	void Add(T value, const Count count = 1) {
+		assert(count > 0);
+		const auto [entry, inserted] = counts_.try_emplace(value, count);
+		if (inserted) {
+			heap_.Add(std::move(value));
+		} else {
+			entry->second += count;
+		}
+		size_ += count;
+	}
+
+	T RemoveMin() {
+		assert(size_ > 0);
+		const auto entry = counts_.find(heap_.Min());
+		--size_;
+		if (--entry->second > 0) return entry->first;
+
+		counts_.erase(entry);
+		return heap_.RemoveMin();
+	}
+
+	T RemoveMax() {
+		assert(size_ > 0);
+		const auto entry = counts_.find(heap_.Max());
+		--size_;
+		if (--entry->second > 0) return entry->first;
+
+		counts_.erase(entry);
+		return heap_.RemoveMax();
+	}
+
+	[[nodiscard]] const T& Min() const {
+		assert(size_ > 0);
+		return heap_.Min();
+	}
+
+	[[nodiscard]] const T& Max() const {
+		assert(size_ > 0);
+		return heap_.Max();
+	}
+
+	// the number of entries, counting every copy of a key
+	[[nodiscard]] Count Size() const noexcept { return size_; }
+
+	// the number of distinct keys, which is what the heap and the index store
+	[[nodiscard]] std::size_t DistinctSize() const noexcept { return counts_.size(); }
+
+	// how many copies of value the queue holds
+	[[nodiscard]] Count CountOf(const T& value) const {
+		const auto entry = counts_.find(value);
+		return entry == counts_.end() ? 0 : entry->second;
+	}
+
+private:
+	Heap heap_;
+	std::unordered_map<T, Count, Hash, KeyEqual> counts_;
+	Count size_ = 0;
+};
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cassert>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+// A symmetric min-max heap is a complete binary tree with an empty root in which every left sibling is no
+// greater than its right sibling, and the left and right children of every node bound the minimum and maximum of
+// the node's grandchildren subtrees. The minimum and maximum are the children of the root. Nodes are numbered
+// from one at the root, so the node of data_[i] is i + 2.
+template <typename T>
+class SymmetricMinMaxHeap {
+
+public:
+	SymmetricMinMaxHeap(std::initializer_list<T> data = {})
+		: SymmetricMinMaxHeap{std::cbegin(data), std::cend(data)} {}
+
+	template <typename TIterator>
+	SymmetricMinMaxHeap(TIterator begin, const TIterator& end) {
+		for (; begin != end; ++begin) Add(*begin);
+	}
+
+	void Add(T value) {
+		data_.push_back(value);
+		auto node = LastNode();
+
+		if (IsRightChild(node) && value < At(node - 1)) {
+			At(node) = std::move(At(node - 1));
+			--node;
+		}
+
+		for (auto grandparent = node / 4; grandparent > 0; grandparent = node / 4) {
+			const auto left = 2 * grandparent;
+			const auto right = left + 1;
+			if (value < At(left)) {
+				At(node) = std::move(At(left));
+				node = left;
+			} else if (At(right) < value) {
+				At(node) = std::move(At(right));
+				node = right;
+			} else {
+				break;
+			}
+		}
+
+		At(node) = std::move(value);
+	}
+
+	T RemoveMin() {
+		assert(!data_.empty());
+		auto min_value = std::move(At(kMinNode));
+		auto value = std::move(data_.back());
+		data_.pop_back();
+		if (data_.empty()) return min_value;
+
+		auto node = kMinNode;
+		while (2 * node <= LastNode()) {
+			auto child = 2 * node;
+			if (2 * node + 2 <= LastNode() && At(2 * node + 2) < At(child)) child = 2 * node + 2;
+			if (!(At(child) < value)) break;
+
+			At(node) = std::move(At(child));
+			node = child;
+			if (node + 1 <= LastNode() && At(node + 1) < value) std::swap(value, At(node + 1));
+		}
+
+		At(node) = std::move(value);
+		return min_value;
+	}
+
+	T RemoveMax() {
+		assert(!data_.empty());
+		if (data_.size() == 1) return RemoveMin();
+
+		auto max_value = std::move(At(kMaxNode));
+		auto value = std::move(data_.back());
+		data_.pop_back();
+		if (data_.size() == 1) return max_value;
+
+		auto node = kMaxNode;
+		while (IsRightChild(node) && 2 * node - 2 <= LastNode()) {
+			auto child = LargestChild(node - 1);
+			if (2 * node <= LastNode() && At(child) < At(LargestChild(node))) child = LargestChild(node);
+			if (!(value < At(child))) break;
+
+			At(node) = std::move(At(child));
+			node = child;
+			if (IsRightChild(node) && value < At(node - 1)) std::swap(value, At(node - 1));
+		}
+
+		At(node) = std::move(value);
+		return max_value;
+	}
+
+	[[nodiscard]] const T& Min() const noexcept {
+		assert(!data_.empty());
+		return At(kMinNode);
+	}
+
+	[[nodiscard]] const T& Max() const noexcept {
+		assert(!data_.empty());
+		return data_.size() == 1 ? At(kMinNode) : At(kMaxNode);
+	}
+
+	[[nodiscard]] int Size() const noexcept { return static_cast<int>(data_.size()); }
+
+private:
+	static constexpr bool IsRightChild(const int node) noexcept { return node % 2 == 1; }
+
+	[[nodiscard]] int LastNode() const noexcept { return Size() + 1; }
+
+	// the right child bounds the subtree of a node from above unless the left child is the only one
+	[[nodiscard]] int LargestChild(const int node) const noexcept {
+		return 2 * node + 1 <= LastNode() ? 2 * node + 1 : 2 * node;
+	}
+
+	T& At(const int node) noexcept { return data_[node - kMinNode]; }
+	const T& At(const int node) const noexcept { return data_[node - kMinNode]; }
+
+	static constexpr auto kMinNode = 2;
+	static constexpr auto kMaxNode = 3;
+	std::vector<T> data_;
+};
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include "min_max_heap.hpp"
+
+// A MinMaxHeap whose elements can be cancelled through the handle that Add returns. MarkDeleted only flags the
+// element as a tombstone in O(1); queries and removals discard tombstones when they reach an end of the heap, and
+// once tombstones make up more than max_dead_fraction of the stored elements, all of them are dropped and the
+// survivors are rebuilt in O(n). A handle is valid until its element is removed or marked deleted.
+template <typename T, typename Policy = MinMaxHeapPolicy, typename Compare = std::less<T>>
+class TombstoneMinMaxHeap {
+
+public:
+	using Handle = typename Policy::IndexType;
+
+private:
+	struct Entry {
+		T value;
+		Handle handle;
+	};
+
+	struct EntryCompare {
+		bool operator()(const Entry& lhs, const Entry& rhs) const { return compare(lhs.value, rhs.value); }
+		Compare compare;
+	};
+
+	enum class Slot : std::uint8_t { kFree, kLive, kDead };
+
+	using Heap = MinMaxHeap<Entry, Policy, EntryCompare>;
+
+public:
+	explicit TombstoneMinMaxHeap(const Compare& compare = Compare{}, const double max_dead_fraction = 0.5)
+		: heap_{std::initializer_list<Entry>{}, EntryCompare{compare}},
+		  compare_{compare},
+		  max_dead_fraction_{max_dead_fraction} {
+		assert(max_dead_fraction > 0.0 && max_dead_fraction < 1.0);
+	}
+
+	Handle Add(T value) {
+		Handle handle;
+		if (free_handles_.empty()) {
+			handle = static_cast<Handle>(slots_.size());
+			slots_.push_back(Slot::kLive);
+		} else {
+			handle = free_handles_.back();
+			free_handles_.pop_back();
+			slots_[handle] = Slot::kLive;
+		}
+		heap_.Add(Entry{std::move(value), handle});
+		return handle;
+	}
+
+	void MarkDeleted(const Handle handle) {
+		assert(IsLive(handle));
+		slots_[handle] = Slot::kDead;
+		if (++dead_ > max_dead_fraction_ * static_cast<double>(heap_.Size())) Compact();
+	}
+
+	[[nodiscard]] bool IsLive(const Handle handle) const noexcept {
+		return static_cast<std::size_t>(handle) < slots_.size() && slots_[handle] == Slot::kLive;
+	}
+
+	T RemoveMin() {
+		assert(Size() > 0);
+		DiscardDeadMin();
+		return Take(heap_.RemoveMin());
+	}
+
+	T RemoveMax() {
+		assert(Size() > 0);
+		DiscardDeadMax();
+		return Take(heap_.RemoveMax());
+	}
+
+	[[nodiscard]] const T& Min() const {
+		assert(Size() > 0);
+		DiscardDeadMin();
+		return heap_.Min().value;
+	}
+
+	[[nodiscard]] const T& Max() const {
+		assert(Size() > 0);
+		DiscardDeadMax();
+		return heap_.Max().value;
+	}
+
+	// the number of live elements
+	[[nodiscard]] Handle Size() const noexcept { return static_cast<Handle>(heap_.Size() - dead_); }
+
+	// drops every tombstone and rebuilds the heap from the live elements in the buffer they were compacted in
+	void Compact() {
+		auto entries = std::move(heap_).Release();
+		const auto size = entries.size();
+		auto live = decltype(size){0};
+		for (auto i = decltype(size){0}; i < size; ++i) {
+			if (slots_[entries[i].handle] == Slot::kDead) {
+				Free(entries[i].handle);
+			} else {
+				entries[live++] = std::move(entries[i]);
+			}
+		}
+		while (entries.size() > live) entries.pop_back();
+
+		assert(dead_ == 0);
+		heap_ = Heap{std::move(entries), EntryCompare{compare_}};
+	}
+
+private:
+	// the heap only changes which of its elements are stored, so the live elements stay the same for const queries
+	void DiscardDeadMin() const {
+		while (slots_[heap_.Min().handle] == Slot::kDead) Free(heap_.RemoveMin().handle);
+	}
+
+	void DiscardDeadMax() const {
+		while (slots_[heap_.Max().handle] == Slot::kDead) Free(heap_.RemoveMax().handle);
+	}
+
+	T Take(Entry entry) {
+		slots_[entry.handle] = Slot::kFree;
+		free_handles_.push_back(entry.handle);
+		return std::move(entry.value);
+	}
+
+	void Free(const Handle handle) const {
+		slots_[handle] = Slot::kFree;
+		free_handles_.push_back(handle);
+		--dead_;
+	}
+
+	mutable Heap heap_;
+	Compare compare_;
+	double max_dead_fraction_;
+	mutable std::vector<Slot> slots_;
+	mutable std::vector<Handle> free_handles_;
+	mutable Handle dead_ = 0;
+};
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cassert>
+#include <initializer_list>
+#include <iterator>
+#include <optional>
+#include <utility>
+#include <vector>
+
+// A twin heap pairs a min-heap and a max-heap of equal size under total correspondence: min_[i] <= max_[i] for
+// every position i. Elements arrive in pairs; an odd element waits in a buffer until its partner arrives, which
+// makes every other Add O(1).
+template <typename T>
+class TwinHeap {
+
+public:
+	TwinHeap(std::initializer_list<T> data = {})
+		: TwinHeap{std::cbegin(data), std::cend(data)} {}
+
+	template <typename TIterator>
+	TwinHeap(TIterator begin, const TIterator& end) {
+		for (; begin != end; ++begin) Add(*begin);
+	}
+
+	void Add(T value) {
+		if (!buffer_) {
+			buffer_ = std::move(value);
+			return;
+		}
+
+		if (value < *buffer_) std::swap(value, *buffer_);
+		min_.push_back(std::move(*buffer_));
+		max_.push_back(std::move(value));
+		buffer_.reset();
+
+		// sifting the pair up keeps every position in correspondence except possibly the new leaf, which can
+		// receive a parent that exceeds its partner; trading the two and sifting again repairs it
+		const auto leaf = static_cast<int>(min_.size()) - 1;
+		HeapifyUpMin(leaf);
+		HeapifyUpMax(leaf);
+		if (max_[leaf] < min_[leaf]) {
+			std::swap(min_[leaf], max_[leaf]);
+			HeapifyUpMin(leaf);
+			HeapifyUpMax(leaf);
+		}
+	}
+
+	T RemoveMin() {
+		assert(Size() > 0);
+		if (buffer_ && (min_.empty() || *buffer_ < min_[0])) return TakeBuffer();
+
+		auto min_value = std::move(min_[0]);
+		if (buffer_) {
+			min_[0] = TakeBuffer();
+		} else {
+			buffer_ = std::move(max_.back());
+			max_.pop_back();
+			if (min_.size() == 1) {
+				min_.pop_back();
+				return min_value;
+			}
+			min_[0] = std::move(min_.back());
+			min_.pop_back();
+		}
+
+		HeapifyDownMin(0);
+		return min_value;
+	}
+
+	T RemoveMax() {
+		assert(Size() > 0);
+		if (buffer_ && (max_.empty() || max_[0] < *buffer_)) return TakeBuffer();
+
+		auto max_value = std::move(max_[0]);
+		if (buffer_) {
+			max_[0] = TakeBuffer();
+		} else {
+			buffer_ = std::move(min_.back());
+			min_.pop_back();
+			if (max_.size() == 1) {
+				max_.pop_back();
+				return max_value;
+			}
+			max_[0] = std::move(max_.back());
+			max_.pop_back();
+		}
+
+		HeapifyDownMax(0);
+		return max_value;
+	}
+
+	[[nodiscard]] const T& Min() const noexcept {
+		assert(Size() > 0);
+		return buffer_ && (min_.empty() || *buffer_ < min_[0]) ? *buffer_ : min_[0];
+	}
+
+	[[nodiscard]] const T& Max() const noexcept {
+		assert(Size() > 0);
+		return buffer_ && (max_.empty() || max_[0] < *buffer_) ? *buffer_ : max_[0];
+	}
+
+	[[nodiscard]] int Size() const noexcept {
+		return static_cast<int>(min_.size() + max_.size()) + (buffer_ ? 1 : 0);
+	}
+
+private:
+	static constexpr int ParentIndex(const int index) noexcept { return (index - 1) / 2; }
+	static constexpr int LeftChildIndex(const int index) noexcept { return 2 * index + 1; }
+
+	T TakeBuffer() {
+		auto value = std::move(*buffer_);
+		buffer_.reset();
+		return value;
+	}
+
+	void HeapifyUpMin(int index) {
+		while (index > 0 && min_[index] < min_[ParentIndex(index)]) {
+			std::swap(min_[index], min_[ParentIndex(index)]);
+			index = ParentIndex(index);
+		}
+	}
+
+	void HeapifyUpMax(int index) {
+		while (index > 0 && max_[ParentIndex(index)] < max_[index]) {
+			std::swap(max_[index], max_[ParentIndex(index)]);
+			index = ParentIndex(index);
+		}
+	}
+
+	// sifts min_[index] down; whenever it overtakes its partner the two trade places and the partner rises
+	void HeapifyDownMin(int index) {
+		const auto size = static_cast<int>(min_.size());
+		while (true) {
+			if (max_[index] < min_[index]) {
+				std::swap(min_[index], max_[index]);
+				HeapifyUpMax(index);
+			}
+
+			auto child = LeftChildIndex(index);
+			if (child >= size) return;
+			if (child + 1 < size && min_[child + 1] < min_[child]) ++child;
+			if (!(min_[child] < min_[index])) return;
+
+			std::swap(min_[child], min_[index]);
+			index = child;
+		}
+	}
+
+	void HeapifyDownMax(int index) {
+		const auto size = static_cast<int>(max_.size());
+		while (true) {
+			if (max_[index] < min_[index]) {
+				std::swap(min_[index], max_[index]);
+				HeapifyUpMin(index);
+			}
+
+			auto child = LeftChildIndex(index);
+			if (child >= size) return;
+			if (child + 1 < size && max_[child] < max_[child + 1]) ++child;
+			if (!(max_[index] < max_[child])) return;
+
+			std::swap(max_[child], max_[index]);
+			index = child;
+		}
+	}
+
+	std::vector<T> min_;
+	std::vector<T> max_;
+	std::optional<T> buffer_;
+};
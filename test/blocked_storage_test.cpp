@@ -0,0 +1,155 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "blocked_storage.hpp"
+#include "min_max_heap.hpp"
+
+namespace {
+struct BlockedPolicy : MinMaxHeapPolicy {
+	template <typename U>
+	using Storage = BlockedStorage<U, 2>;
+};
+
+struct MoveCountingInt {
+	static inline long moves = 0;
+
+	MoveCountingInt() = default;
+	explicit MoveCountingInt(const int value) : value{value} {}
+	MoveCountingInt(const MoveCountingInt&) = default;
+	MoveCountingInt& operator=(const MoveCountingInt&) = default;
+	MoveCountingInt(MoveCountingInt&& other) noexcept : value{other.value} { ++moves; }
+	MoveCountingInt& operator=(MoveCountingInt&& other) noexcept {
+		value = other.value;
+		++moves;
+		return *this;
+	}
+	bool operator<(const MoveCountingInt& other) const noexcept { return value < other.value; }
+
+	int value = 0;
+};
+
+struct ShrinkingBlockedPolicy : MinMaxHeapPolicy {
+	static constexpr int kShrinkAfterPops = 8;
+
+	template <typename U>
+	using Storage = BlockedStorage<U, 4>;
+};
+}
+
+TEST_CASE("Blocked storage", "[BlockedStorage]") {
+
+	SECTION("Every index maps to a distinct position") {
+		using Storage = BlockedStorage<int, 3>;
+		REQUIRE(Storage::kBlockSize == 7);
+		REQUIRE(Storage::kBlockStride == 8);
+
+		std::vector<std::size_t> positions;
+		for (std::size_t i = 0; i < 511; ++i) positions.push_back(Storage::Position(i));
+		std::sort(positions.begin(), positions.end());
+
+		SECTION("Positions of a complete tree fill the blocks up to their padding") {
+			for (std::size_t i = 0; i < positions.size(); ++i) {
+				REQUIRE(positions[i] == i / 7 * 8 + i % 7);
+			}
+		}
+	}
+
+	SECTION("Every index of a 4-ary tree maps to a distinct position") {
+		using Storage = BlockedStorage<int, 3, 4>;
+		REQUIRE(Storage::kBlockSize == 21);
+		REQUIRE(Storage::kBlockStride == 32);
+
+		std::vector<std::size_t> positions;
+		for (std::size_t i = 0; i < 1365; ++i) positions.push_back(Storage::Position(i));
+		std::sort(positions.begin(), positions.end());
+
+		for (std::size_t i = 0; i < positions.size(); ++i) {
+			REQUIRE(positions[i] == i / 21 * 32 + i % 21);
+		}
+	}
+
+	SECTION("A parent and its children share a block") {
+		for (std::size_t i = 0; i < 100; ++i) {
+			const auto block = BlockedStorage<int, 2>::Position(i) / 4;
+			const auto level = static_cast<int>(std::log2(i + 1));
+			if (level % 2 == 0) {
+				REQUIRE(BlockedStorage<int, 2>::Position(2 * i + 1) / 4 == block);
+				REQUIRE(BlockedStorage<int, 2>::Position(2 * i + 2) / 4 == block);
+			}
+		}
+	}
+
+	SECTION("Every subtree of a cache line blocked storage lies within one cache line") {
+		REQUIRE(CacheLineBlockLevels<std::uint64_t>() == 3);
+		CacheLineBlockedStorage<std::uint64_t> storage;
+		for (std::uint64_t i = 0; i < 100'000; ++i) storage.push_back(i);
+
+		const auto line = [&](const std::size_t index) {
+			return reinterpret_cast<std::uintptr_t>(&storage[index]) / 64;
+		};
+		for (std::size_t i = 0; 2 * i + 2 < storage.size(); ++i) {
+			const auto level = static_cast<int>(std::log2(i + 1));
+			if (level % 3 != 2) {
+				REQUIRE(line(2 * i + 1) == line(i));
+				REQUIRE(line(2 * i + 2) == line(i));
+			}
+		}
+	}
+
+	SECTION("Elements read back in the order they were added") {
+		BlockedStorage<int, 3> storage;
+		for (auto i = 0; i < 100; ++i) storage.push_back(i);
+		for (auto i = 0; i < 50; ++i) storage.pop_back();
+
+		REQUIRE(storage.size() == 50);
+		for (auto i = 0; i < 50; ++i) {
+			REQUIRE(storage[i] == i);
+		}
+	}
+
+	SECTION("Reserved capacity holds that many elements without allocating") {
+		for (std::size_t n = 0; n < 2000; n += 37) {
+			BlockedStorage<int, 3> storage;
+			storage.reserve(n);
+			const auto capacity = storage.capacity();
+			REQUIRE(capacity >= n);
+			for (std::size_t i = 0; i < capacity; ++i) storage.push_back(static_cast<int>(i));
+			REQUIRE(storage.capacity() == capacity);
+		}
+	}
+
+	SECTION("A sparse heap over blocked storage releases capacity without copying on every attempt") {
+		MinMaxHeap<MoveCountingInt, ShrinkingBlockedPolicy> heap;
+		for (auto i = 0; i < 110'000; ++i) heap.Add(MoveCountingInt{i});
+		const auto peak = heap.Capacity();
+		REQUIRE(peak < 2 * 110'000);
+
+		// a size past the first level of a block row needs the whole row, so the capacity cannot halve every time
+		MoveCountingInt::moves = 0;
+		for (auto i = 0; i < 109'000; ++i) REQUIRE(heap.RemoveMin().value == i);
+		REQUIRE(MoveCountingInt::moves < 109'000 * 100);
+		REQUIRE(heap.Capacity() < peak / 4);
+		REQUIRE(heap.Capacity() >= heap.Size());
+		REQUIRE(heap.Min().value == 109'000);
+		REQUIRE(heap.Max().value == 109'999);
+	}
+
+	SECTION("A min-max heap over blocked storage removes elements in the correct order") {
+		std::vector<int> values(3000);
+		std::iota(values.begin(), values.end(), 0);
+		std::shuffle(values.begin(), values.end(), std::mt19937{5});
+		MinMaxHeap<int, BlockedPolicy> heap{values.cbegin(), values.cend()};
+
+		for (auto low = 0, high = 2999; low <= high; ++low, --high) {
+			REQUIRE(heap.RemoveMin() == low);
+			REQUIRE(heap.RemoveMax() == high);
+		}
+		REQUIRE(heap.Size() == 0);
+	}
+}
@@ -0,0 +1,65 @@
+#include <cstdint>
+#include <random>
+#include <set>
+#include <type_traits>
+
+#include "catch.hpp"
+
+#include "bucket_depq.hpp"
+#include "reference_check.hpp"
+
+TEMPLATE_TEST_CASE("Bucket double-ended priority queue", "[BucketDEPQ]", int, std::int8_t, std::uint16_t) {
+
+	SECTION("Both extremes are tracked through duplicates") {
+		BucketDEPQ<TestType> queue{0, 100, {40, 7, 40, 99, 7, 0}};
+		REQUIRE(queue.Size() == 6);
+		REQUIRE(queue.Min() == 0);
+		REQUIRE(queue.Max() == 99);
+
+		REQUIRE(queue.RemoveMin() == 0);
+		REQUIRE(queue.RemoveMin() == 7);
+		REQUIRE(queue.Min() == 7);
+		REQUIRE(queue.RemoveMax() == 99);
+		REQUIRE(queue.RemoveMax() == 40);
+		REQUIRE(queue.Max() == 40);
+		REQUIRE(queue.RemoveMax() == 40);
+		REQUIRE(queue.RemoveMin() == 7);
+		REQUIRE(queue.Size() == 0);
+
+		queue.Add(100);
+		REQUIRE(queue.Min() == 100);
+		REQUIRE(queue.Max() == 100);
+	}
+
+	SECTION("Random operations over the whole range agree with an ordered multiset") {
+		const auto low = static_cast<TestType>(std::is_signed_v<TestType> ? -100 : 1'000);
+		const auto high = static_cast<TestType>(std::is_signed_v<TestType> ? 100 : 60'000);
+		std::mt19937 engine{113};
+		std::uniform_int_distribution<int> distribution{low, high};
+		BucketDEPQ<TestType> queue{low, high};
+		std::multiset<TestType> reference;
+
+		RequireAgreementUnderRandomOperations(queue, reference, engine, 20'000, 40, [&](int) {
+			const auto value = static_cast<TestType>(distribution(engine));
+			queue.Add(value);
+			reference.insert(value);
+		});
+	}
+}
+
+TEST_CASE("Bucket double-ended priority queue range", "[BucketDEPQ]") {
+
+	SECTION("A range spanning the whole key type is supported") {
+		BucketDEPQ<std::int16_t> queue{INT16_MIN, INT16_MAX, {INT16_MAX, 0, INT16_MIN}};
+		REQUIRE(queue.RemoveMin() == INT16_MIN);
+		REQUIRE(queue.RemoveMax() == INT16_MAX);
+		REQUIRE(queue.Max() == 0);
+	}
+
+	SECTION("A single key range holds copies of that key") {
+		BucketDEPQ<int> queue{5, 5, {5, 5}};
+		REQUIRE(queue.RemoveMax() == 5);
+		REQUIRE(queue.RemoveMin() == 5);
+		REQUIRE(queue.Size() == 0);
+	}
+}
@@ -0,0 +1,68 @@
+#include <functional>
+
+#include "catch.hpp"
+
+#include "buffered_min_max_heap.hpp"
+
+TEST_CASE("Insertion buffer", "[BufferedMinMaxHeap]") {
+
+	SECTION("The extremes are found in the buffer as well as in the heap") {
+		BufferedMinMaxHeap<int, 4> heap{5, 3, 9};
+		heap.Add(1);
+		heap.Add(12);
+		REQUIRE(heap.Size() == 5);
+		REQUIRE(heap.Min() == 1);
+		REQUIRE(heap.Max() == 12);
+
+		REQUIRE(heap.RemoveMax() == 12);
+		REQUIRE(heap.RemoveMax() == 9);
+		REQUIRE(heap.RemoveMin() == 1);
+		REQUIRE(heap.RemoveMin() == 3);
+		REQUIRE(heap.RemoveMin() == 5);
+		REQUIRE(heap.Size() == 0);
+	}
+
+	SECTION("Flushing moves the buffered elements into the heap without changing the contents") {
+		BufferedMinMaxHeap<int, 8> heap;
+		for (const auto value : {4, 8, 2, 6}) heap.Add(value);
+		heap.Flush();
+		heap.Flush();
+		REQUIRE(heap.Size() == 4);
+		REQUIRE(heap.Min() == 2);
+		REQUIRE(heap.Max() == 8);
+	}
+
+	SECTION("Filling the buffer exactly keeps it apart, and one more addition flushes it") {
+		BufferedMinMaxHeap<int, 4> heap{10};
+		for (const auto value : {3, 12, 7, 5}) heap.Add(value);
+		REQUIRE(heap.Size() == 5);
+		REQUIRE(heap.Min() == 3);
+		REQUIRE(heap.Max() == 12);
+
+		heap.Add(11);
+		REQUIRE(heap.Size() == 6);
+		REQUIRE(heap.RemoveMin() == 3);
+		REQUIRE(heap.RemoveMax() == 12);
+		REQUIRE(heap.RemoveMax() == 11);
+		REQUIRE(heap.RemoveMin() == 5);
+		REQUIRE(heap.RemoveMin() == 7);
+		REQUIRE(heap.RemoveMin() == 10);
+		REQUIRE(heap.Size() == 0);
+	}
+
+	SECTION("Copies of an extreme in both the buffer and the heap are removed one at a time") {
+		BufferedMinMaxHeap<int, 4, MinMaxHeapPolicy, std::greater<int>> heap{5, 9};
+		heap.Add(9);
+		heap.Add(5);
+		REQUIRE(heap.Min() == 9);
+		REQUIRE(heap.Max() == 5);
+
+		REQUIRE(heap.RemoveMin() == 9);
+		REQUIRE(heap.Min() == 9);
+		REQUIRE(heap.RemoveMin() == 9);
+		REQUIRE(heap.RemoveMax() == 5);
+		REQUIRE(heap.Max() == 5);
+		REQUIRE(heap.RemoveMax() == 5);
+		REQUIRE(heap.Size() == 0);
+	}
+}
@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "double_ended_priority_queue.hpp"
+#include "reference_check.hpp"
+
+#define DEPQ_BACKENDS MinMaxHeapBackend, IntervalHeapBackend, SymmetricMinMaxHeapBackend, DeapBackend, TwinHeapBackend, \
+	MeldableMinMaxHeapBackend, BufferedMinMaxHeapBackend
+
+TEMPLATE_TEST_CASE("Double-ended priority queue initialization", "[DoubleEndedPriorityQueue]", DEPQ_BACKENDS) {
+
+	SECTION("Initializing a queue with no elements") {
+		const DoubleEndedPriorityQueue<int, TestType> queue;
+
+		SECTION("The queue has a size of zero") {
+			REQUIRE(queue.Size() == 0);
+		}
+	}
+
+	SECTION("Initializing a queue with one element") {
+		const DoubleEndedPriorityQueue<int, TestType> queue{5};
+
+		SECTION("The minimum and maximum elements are the element initially added to the queue") {
+			REQUIRE(queue.Size() == 1);
+			REQUIRE(queue.Min() == 5);
+			REQUIRE(queue.Max() == 5);
+		}
+	}
+
+	SECTION("Initializing a queue with a random collection of elements") {
+		const DoubleEndedPriorityQueue<int, TestType> queue{6, 8, 4, 10, 12, 5, 1, 14, 9, 2, 13, 3, 0, 7, 11};
+
+		SECTION("The minimum and maximum elements equal the extremes of the collection") {
+			REQUIRE(queue.Size() == 15);
+			REQUIRE(queue.Min() == 0);
+			REQUIRE(queue.Max() == 14);
+		}
+	}
+
+	SECTION("Initializing a queue with a collection of duplicate elements") {
+		const DoubleEndedPriorityQueue<int, TestType> queue{7, 7, 7, 7, 7, 7, 7};
+
+		SECTION("The minimum and maximum elements equal the duplicated element") {
+			REQUIRE(queue.Size() == 7);
+			REQUIRE(queue.Min() == 7);
+			REQUIRE(queue.Max() == 7);
+		}
+	}
+}
+
+TEMPLATE_TEST_CASE("Double-ended priority queue removal", "[DoubleEndedPriorityQueue]", DEPQ_BACKENDS) {
+	DoubleEndedPriorityQueue<int, TestType> queue{9, 6, 1, 4, 8, 3, 2, 7, 5, 0};
+
+	SECTION("Elements removed by continuously extracting the minimum are in the correct order") {
+		for (auto i = 0; i < 10; ++i) {
+			REQUIRE(queue.RemoveMin() == i);
+		}
+	}
+
+	SECTION("Elements removed by continuously extracting the maximum are in the correct order") {
+		for (auto i = 9; i >= 0; --i) {
+			REQUIRE(queue.RemoveMax() == i);
+		}
+	}
+
+	SECTION("Elements removed by alternating between both ends are in the correct order") {
+		for (auto low = 0, high = 9; low < high; ++low, --high) {
+			REQUIRE(queue.RemoveMin() == low);
+			REQUIRE(queue.RemoveMax() == high);
+		}
+		REQUIRE(queue.Size() == 0);
+	}
+}
+
+TEMPLATE_TEST_CASE("Double-ended priority queue operations", "[DoubleEndedPriorityQueue]", DEPQ_BACKENDS) {
+
+	SECTION("Interleaved additions and removals agree with an ordered multiset") {
+		for (auto seed = 0u; seed < 8; ++seed) {
+			std::mt19937 engine{seed};
+			std::uniform_int_distribution distribution{0, 99};
+			DoubleEndedPriorityQueue<int, TestType> queue;
+			std::multiset<int> reference;
+
+			// the share of removals grows with the seed, so later queues stay smaller
+			RequireAgreementUnderRandomOperations(queue, reference, engine, 3000, 40 + static_cast<int>(seed) * 10,
+				[&](int) {
+					const auto value = distribution(engine);
+					queue.Add(value);
+					reference.insert(value);
+				});
+		}
+	}
+
+	SECTION("Draining queues of every size up to 64 yields their elements in sorted order") {
+		for (auto n = 0; n <= 64; ++n) {
+			std::vector<std::string> values(n);
+			std::mt19937 engine{static_cast<unsigned>(n)};
+			for (auto& value : values) value = std::to_string(engine() % 50);
+			DoubleEndedPriorityQueue<std::string, TestType> queue{values.cbegin(), values.cend()};
+			std::sort(values.begin(), values.end());
+
+			for (auto low = 0, high = n - 1; low <= high; ++low, --high) {
+				REQUIRE(queue.RemoveMin() == values[low]);
+				if (low < high) REQUIRE(queue.RemoveMax() == values[high]);
+			}
+		}
+	}
+}
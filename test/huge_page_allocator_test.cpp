@@ -0,0 +1,57 @@
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "huge_page_allocator.hpp"
+#include "min_max_heap.hpp"
+
+namespace {
+struct HugePagePolicy : MinMaxHeapPolicy {
+	template <typename U>
+	using Storage = HugePageStorage<U>;
+};
+}
+
+TEST_CASE("Huge page allocator", "[HugePageAllocator]") {
+
+	SECTION("Buffers at least one huge page in size start on a huge page boundary") {
+		HugePageAllocator<std::uint64_t> allocator;
+		constexpr auto n = std::size_t{3} << 18;
+		REQUIRE(HugePageAllocator<std::uint64_t>::IsMapped(n) == HugePageAllocator<std::uint64_t>::IsMapped(1 << 18));
+
+		auto* const data = allocator.allocate(n);
+		if (HugePageAllocator<std::uint64_t>::IsMapped(n)) {
+			REQUIRE(reinterpret_cast<std::uintptr_t>(data) % HugePageAllocator<std::uint64_t>::kHugePageSize == 0);
+		}
+		for (std::size_t i = 0; i < n; ++i) data[i] = i;
+		REQUIRE(std::accumulate(data, data + n, std::uint64_t{0}) == n * (n - 1) / 2);
+		allocator.deallocate(data, n);
+	}
+
+	SECTION("Small buffers are not mapped") {
+		REQUIRE_FALSE(HugePageAllocator<std::uint64_t>::IsMapped(1000));
+	}
+
+	SECTION("A vector keeps its elements while growing across the huge page threshold") {
+		HugePageStorage<int> storage;
+		for (auto i = 0; i < 2'000'000; ++i) storage.push_back(i);
+		for (auto i = 0; i < 2'000'000; i += 1'000) REQUIRE(storage[i] == i);
+	}
+
+	SECTION("A min-max heap over huge page storage removes elements in the correct order") {
+		std::vector<int> values(1'000'000);
+		std::iota(values.begin(), values.end(), 0);
+		std::shuffle(values.begin(), values.end(), std::mt19937{47});
+		MinMaxHeap<int, HugePagePolicy> heap{values.cbegin(), values.cend()};
+
+		for (auto low = 0, high = 999'999; low < 1'000; ++low, --high) {
+			REQUIRE(heap.RemoveMin() == low);
+			REQUIRE(heap.RemoveMax() == high);
+		}
+		REQUIRE(heap.Size() == 998'000);
+	}
+}
@@ -0,0 +1,83 @@
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "interval_heap.hpp"
+#include "reference_check.hpp"
+
+TEST_CASE("Interval heap initialization", "[IntervalHeap]") {
+
+	SECTION("Initializing an interval heap with no elements") {
+		const IntervalHeap<int> heap;
+
+		SECTION("The heap has a size of zero") {
+			REQUIRE(heap.Size() == 0);
+		}
+	}
+
+	SECTION("Initializing an interval heap with one element") {
+		const IntervalHeap heap{3};
+
+		SECTION("The minimum and maximum elements are the element initially added to the heap") {
+			REQUIRE(heap.Size() == 1);
+			REQUIRE(heap.Min() == 3);
+			REQUIRE(heap.Max() == 3);
+		}
+	}
+
+	SECTION("Initializing an interval heap with a random collection of elements") {
+		const IntervalHeap heap{6, 8, 4, 10, 12, 5, 1, 14, 9, 2, 13, 3, 0, 7, 11};
+
+		SECTION("The minimum and maximum elements equal the extremes of the collection") {
+			REQUIRE(heap.Size() == 15);
+			REQUIRE(heap.Min() == 0);
+			REQUIRE(heap.Max() == 14);
+		}
+	}
+}
+
+TEST_CASE("Interval heap removal", "[IntervalHeap]") {
+	IntervalHeap heap{9, 6, 1, 4, 8, 3, 2, 7, 5, 0};
+
+	SECTION("Elements removed by continuously extracting the minimum are in the correct order") {
+		for (auto i = 0; i < 10; ++i) {
+			REQUIRE(heap.RemoveMin() == i);
+		}
+	}
+
+	SECTION("Elements removed by continuously extracting the maximum are in the correct order") {
+		for (auto i = 9; i >= 0; --i) {
+			REQUIRE(heap.RemoveMax() == i);
+		}
+	}
+
+	SECTION("Interleaved additions and removals agree with an ordered multiset") {
+		std::mt19937 engine{17};
+		std::uniform_int_distribution distribution{0, 99};
+		std::multiset<int> reference{9, 6, 1, 4, 8, 3, 2, 7, 5, 0};
+
+		RequireAgreementUnderRandomOperations(heap, reference, engine, 5000, 70, [&](int) {
+			const auto value = distribution(engine);
+			heap.Add(value);
+			reference.insert(value);
+		});
+	}
+
+	SECTION("Draining a heap built from random elements yields them in sorted order") {
+		for (auto n = 0; n < 64; ++n) {
+			std::vector<int> values(n);
+			std::mt19937 engine{static_cast<unsigned>(n)};
+			for (auto& value : values) value = static_cast<int>(engine() % 20);
+			IntervalHeap<int> random_heap{values.cbegin(), values.cend()};
+			std::sort(values.begin(), values.end());
+
+			for (auto low = 0, high = n - 1; low <= high; ++low, --high) {
+				REQUIRE(random_heap.RemoveMin() == values[low]);
+				if (low < high) REQUIRE(random_heap.RemoveMax() == values[high]);
+			}
+		}
+	}
+}
@@ -0,0 +1,124 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "meldable_min_max_heap.hpp"
+#include "reference_check.hpp"
+
+TEST_CASE("Meld", "[MeldableMinMaxHeap]") {
+	MeldableMinMaxHeap heap{9, 6, 1, 4, 8};
+	MeldableMinMaxHeap other{3, 2, 7, 5, 0};
+
+	SECTION("Melding two heaps") {
+		heap.Meld(std::move(other));
+
+		SECTION("The melded heap contains the elements of both heaps") {
+			REQUIRE(heap.Size() == 10);
+			REQUIRE(heap.Min() == 0);
+			REQUIRE(heap.Max() == 9);
+		}
+
+		SECTION("The heap melded into the other is left empty") {
+			REQUIRE(other.Size() == 0);
+		}
+
+		SECTION("Elements removed from both ends of the melded heap are in the correct order") {
+			for (auto low = 0, high = 9; low < high; ++low, --high) {
+				REQUIRE(heap.RemoveMin() == low);
+				REQUIRE(heap.RemoveMax() == high);
+			}
+		}
+
+		SECTION("The emptied heap can be reused") {
+			other.Add(11);
+			REQUIRE(other.Min() == 11);
+			REQUIRE(other.Max() == 11);
+		}
+	}
+
+	SECTION("Melding an empty heap leaves the heap unchanged") {
+		heap.Meld(MeldableMinMaxHeap<int>{});
+		REQUIRE(heap.Size() == 5);
+		REQUIRE(heap.Min() == 1);
+		REQUIRE(heap.Max() == 9);
+	}
+
+	SECTION("Repeatedly melding and removing agrees with an ordered multiset") {
+		std::mt19937 engine{23};
+		std::vector<MeldableMinMaxHeap<std::string>> heaps(64);
+		std::vector<std::multiset<std::string>> references(64);
+
+		for (auto i = 0; i < 4000; ++i) {
+			const auto target = engine() % 64;
+			const auto source = engine() % 64;
+			auto& heap_target = heaps[target];
+			auto& reference = references[target];
+
+			switch (engine() % 4) {
+				case 0:
+					if (target != source) {
+						heap_target.Meld(std::move(heaps[source]));
+						reference.merge(references[source]);
+					}
+					break;
+				case 1:
+					if (!reference.empty()) RemoveMinFromBoth(heap_target, reference);
+					break;
+				case 2:
+					if (!reference.empty()) RemoveMaxFromBoth(heap_target, reference);
+					break;
+				default: {
+					const auto value = std::to_string(engine() % 1000);
+					heap_target.Add(value);
+					reference.insert(value);
+				}
+			}
+
+			RequireAgreement(heap_target, reference);
+		}
+	}
+}
+
+namespace {
+// a value whose move throws when it is marked, as the move into a pool node does
+struct ThrowingMove {
+	explicit ThrowingMove(const int value, const bool throws = false) : value{value}, throws{throws} {}
+	ThrowingMove(const ThrowingMove&) = default;
+	ThrowingMove(ThrowingMove&& other) : value{other.value}, throws{other.throws} {
+		if (throws) throw std::runtime_error{"move failed"};
+	}
+	bool operator<(const ThrowingMove& other) const noexcept { return value < other.value; }
+	bool operator>(const ThrowingMove& other) const noexcept { return value > other.value; }
+
+	int value;
+	bool throws;
+};
+
+std::uintptr_t Distance(const ThrowingMove& a, const ThrowingMove& b) {
+	return reinterpret_cast<std::uintptr_t>(&b) - reinterpret_cast<std::uintptr_t>(&a);
+}
+}
+
+TEST_CASE("Node pool", "[MeldableMinMaxHeap]") {
+
+	SECTION("A throwing constructor leaves its slot to the next addition") {
+		MeldableMinMaxHeap<ThrowingMove> expected;
+		expected.Add(ThrowingMove{0});
+		expected.Add(ThrowingMove{1});
+
+		MeldableMinMaxHeap<ThrowingMove> heap;
+		heap.Add(ThrowingMove{0});
+		REQUIRE_THROWS_AS(heap.Add(ThrowingMove{2, true}), std::runtime_error);
+		REQUIRE(heap.Size() == 1);
+		heap.Add(ThrowingMove{1});
+
+		REQUIRE(heap.Max().value == 1);
+		REQUIRE(Distance(heap.Min(), heap.Max()) == Distance(expected.Min(), expected.Max()));
+	}
+}
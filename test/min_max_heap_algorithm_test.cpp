@@ -0,0 +1,180 @@
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "min_max_heap_algorithm.hpp"
+
+namespace {
+struct QuaternaryPolicy : MinMaxHeapPolicy {
+	static constexpr int kArity = 4;
+};
+
+template <int Threads, int Arity = 2>
+struct ThreadedPolicy : MinMaxHeapPolicy {
+	static constexpr int kArity = Arity;
+	static constexpr int kBuildThreads = Threads;
+};
+}
+
+TEST_CASE("Min-max heap algorithms", "[MinMaxHeapAlgorithm]") {
+	std::array<int, 500> values{};
+	std::iota(values.begin(), values.end(), 0);
+	std::shuffle(values.begin(), values.end(), std::mt19937{59});
+
+	SECTION("A range arranged in place pops its minimum and maximum to the back") {
+		make_minmax_heap(values.begin(), values.end());
+		REQUIRE(is_minmax_heap(values.begin(), values.end()));
+
+		auto last = values.end();
+		for (auto low = 0, high = 499; low <= high; ++low, --high) {
+			pop_minmax_min(values.begin(), last);
+			REQUIRE(*--last == low);
+			REQUIRE(is_minmax_heap(values.begin(), last));
+
+			if (low < high) {
+				pop_minmax_max(values.begin(), last);
+				REQUIRE(*--last == high);
+				REQUIRE(is_minmax_heap(values.begin(), last));
+			}
+		}
+	}
+
+	SECTION("Pushing the elements one at a time yields a min-max heap") {
+		for (auto last = values.begin(); last != values.end();) {
+			push_minmax_heap(values.begin(), ++last);
+			REQUIRE(is_minmax_heap(values.begin(), last));
+		}
+		REQUIRE(values[0] == 0);
+		REQUIRE(std::max(values[1], values[2]) == 499);
+	}
+
+	SECTION("A comparator reverses the order") {
+		std::deque<int> reversed(values.cbegin(), values.cend());
+		make_minmax_heap(reversed.begin(), reversed.end(), std::greater<>{});
+		REQUIRE(is_minmax_heap(reversed.begin(), reversed.end(), std::greater<>{}));
+		REQUIRE(reversed.front() == 499);
+
+		pop_minmax_max(reversed.begin(), reversed.end(), std::greater<>{});
+		REQUIRE(reversed.back() == 0);
+	}
+
+	SECTION("The policy selects the arity") {
+		make_minmax_heap<QuaternaryPolicy>(values.begin(), values.end());
+		REQUIRE(is_minmax_heap<QuaternaryPolicy>(values.begin(), values.end()));
+		REQUIRE(*std::max_element(values.begin() + 1, values.begin() + 5) == 499);
+
+		std::multiset<int> reference(values.cbegin(), values.cend());
+		for (auto last = values.end(); last != values.begin(); --last) {
+			pop_minmax_max<QuaternaryPolicy>(values.begin(), last);
+			REQUIRE(*(last - 1) == *reference.rbegin());
+			reference.erase(std::prev(reference.end()));
+		}
+	}
+
+	SECTION("The longest valid prefix ends at the first element out of order") {
+		std::vector<int> heap{1, 9, 8, 2, 3, 4, 5};
+		REQUIRE(is_minmax_heap(heap.begin(), heap.end()));
+
+		heap[5] = 0;
+		REQUIRE(is_minmax_heap_until(heap.begin(), heap.end()) == heap.begin() + 5);
+
+		heap[5] = 10;
+		REQUIRE(is_minmax_heap_until(heap.begin(), heap.end()) == heap.begin() + 5);
+
+		heap[5] = 4;
+		heap[6] = 5;
+		heap.push_back(0);
+		REQUIRE(is_minmax_heap_until(heap.begin(), heap.end()) == heap.begin() + 7);
+	}
+}
+
+TEST_CASE("Min-max heap sorting", "[MinMaxHeapAlgorithm]") {
+	std::mt19937 engine{67};
+	std::uniform_int_distribution distribution{0, 999};
+
+	SECTION("Heap sort agrees with std::sort") {
+		for (const auto n : {0, 1, 2, 3, 17, 1000}) {
+			std::vector<int> values(n);
+			for (auto& value : values) value = distribution(engine);
+			auto expected = values;
+			std::sort(expected.begin(), expected.end());
+
+			minmax_heap_sort(values.begin(), values.end());
+			REQUIRE(values == expected);
+
+			minmax_heap_sort(values.begin(), values.end(), std::greater<>{});
+			REQUIRE(std::equal(values.begin(), values.end(), expected.rbegin()));
+		}
+	}
+
+	SECTION("Partial sorting places both ends and keeps the elements in between") {
+		for (const auto n : {1, 10, 500}) {
+			for (const auto& [low, high] : {std::pair{0, 0}, {1, 0}, {0, 1}, {n / 2, n / 2}, {n / 3, n / 10}, {n, 0},
+					 {n / 10, n - n / 10}}) {
+				std::vector<int> values(n);
+				for (auto& value : values) value = distribution(engine);
+				auto expected = values;
+				std::sort(expected.begin(), expected.end());
+
+				minmax_partial_sort_both_ends(values.begin(), values.end(), low, high);
+				REQUIRE(std::equal(values.begin(), values.begin() + low, expected.begin()));
+				REQUIRE(std::equal(values.end() - high, values.end(), expected.end() - high));
+
+				std::sort(values.begin(), values.end());
+				REQUIRE(values == expected);
+			}
+		}
+	}
+}
+
+TEST_CASE("Parallel min-max heap construction", "[MinMaxHeapAlgorithm]") {
+	std::mt19937 engine{71};
+	std::uniform_int_distribution distribution{0, 1'000'000};
+
+	for (const auto n : {100, 50'000, 200'003}) {
+		std::vector<int> values(n);
+		for (auto& value : values) value = distribution(engine);
+		const auto [min, max] = std::minmax_element(values.cbegin(), values.cend());
+		const auto expected_min = *min;
+		const auto expected_max = *max;
+
+		SECTION("Subtrees built on separate threads form one min-max heap, n = " + std::to_string(n)) {
+			auto binary = values;
+			make_minmax_heap<ThreadedPolicy<3>>(binary.begin(), binary.end());
+			REQUIRE(is_minmax_heap(binary.begin(), binary.end()));
+			REQUIRE(binary[0] == expected_min);
+			REQUIRE(std::max(binary[1], binary[2]) == expected_max);
+
+			auto quaternary = values;
+			make_minmax_heap<ThreadedPolicy<5, 4>>(quaternary.begin(), quaternary.end());
+			REQUIRE(is_minmax_heap<QuaternaryPolicy>(quaternary.begin(), quaternary.end()));
+
+			auto hardware = values;
+			make_minmax_heap<ThreadedPolicy<0>>(hardware.begin(), hardware.end(), std::greater<>{});
+			REQUIRE(is_minmax_heap(hardware.begin(), hardware.end(), std::greater<>{}));
+			REQUIRE(hardware[0] == expected_max);
+		}
+	}
+
+	SECTION("An exception thrown by the comparator on a worker thread reaches the caller") {
+		std::vector<int> values(200'003);
+		for (auto& value : values) value = distribution(engine);
+		// the last element lies in a subtree heapified by a worker thread
+		values.back() = -1;
+		const auto throwing_less = [](const int a, const int b) {
+			if (a < 0 || b < 0) throw std::runtime_error{"comparison failed"};
+			return a < b;
+		};
+		REQUIRE_THROWS_AS(make_minmax_heap<ThreadedPolicy<3>>(values.begin(), values.end(), throwing_less),
+			std::runtime_error);
+	}
+}
@@ -1,10 +1,19 @@
 #define CATCH_CONFIG_MAIN
 
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
 #include <vector>
 
 #include "catch.hpp"
 
+#include "blocked_storage.hpp"
 #include "min_max_heap.hpp"
+#include "reference_check.hpp"
 
 TEST_CASE("Initialization", "[MinMaxHeap]") {
 
@@ -96,6 +105,20 @@ TEST_CASE("Initialization", "[MinMaxHeap]") {
 			REQUIRE(heap.Max() == 7);
 		}
 	}
+
+	SECTION("Initializing a min-max heap from a single-pass stream of elements") {
+		std::istringstream stream{"5 3 9 1 7 2 8 6 4 0 12 11 10 15 14 13 19 18 17 16 3"};
+		MinMaxHeap<int> heap{std::istream_iterator<int>{stream}, std::istream_iterator<int>{}};
+
+		SECTION("The heap holds every element read from the stream and removes them in order") {
+			REQUIRE(heap.Size() == 21);
+			REQUIRE(heap.Max() == 19);
+
+			std::vector<int> ascending;
+			while (heap.Size() > 0) ascending.push_back(heap.RemoveMin());
+			REQUIRE(ascending == std::vector{0, 1, 2, 3, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19});
+		}
+	}
 }
 
 TEST_CASE("Add", "[MinMaxHeap]") {
@@ -193,3 +216,562 @@ TEST_CASE("Remove", "[MinMaxHeap]") {
 		}
 	}
 }
+
+namespace {
+struct BranchingInt {
+	int value;
+	bool operator<(const BranchingInt& other) const noexcept { return value < other.value; }
+	bool operator>(const BranchingInt& other) const noexcept { return value > other.value; }
+	bool operator==(const BranchingInt& other) const noexcept { return value == other.value; }
+};
+}
+
+TEST_CASE("Branch-free sifting", "[MinMaxHeap]") {
+	std::mt19937 engine{7};
+	std::uniform_int_distribution distribution{0, 99};
+	MinMaxHeap<int> heap;
+	MinMaxHeap<BranchingInt> reference;
+
+	SECTION("Interleaved additions and removals agree with the branching implementation") {
+		for (auto i = 0; i < 2000; ++i) {
+			const auto value = distribution(engine);
+			if (value < 40 && heap.Size() > 0) {
+				REQUIRE(heap.RemoveMin() == reference.RemoveMin().value);
+			} else if (value < 60 && heap.Size() > 0) {
+				REQUIRE(heap.RemoveMax() == reference.RemoveMax().value);
+			} else {
+				heap.Add(value);
+				reference.Add(BranchingInt{value});
+			}
+			REQUIRE(heap.Size() == reference.Size());
+		}
+	}
+
+	SECTION("Draining a heap built from random elements yields them in sorted order") {
+		std::vector<int> values(1000);
+		for (auto& value : values) value = distribution(engine);
+		MinMaxHeap<int> random_heap{values.cbegin(), values.cend()};
+		std::sort(values.begin(), values.end());
+
+		for (auto low = 0, high = static_cast<int>(values.size()) - 1; low <= high; ++low, --high) {
+			REQUIRE(random_heap.RemoveMin() == values[low]);
+			if (low < high) REQUIRE(random_heap.RemoveMax() == values[high]);
+		}
+	}
+}
+
+namespace {
+struct PrefetchPolicy : MinMaxHeapPolicy {
+	static constexpr bool kPrefetch = true;
+};
+}
+
+TEST_CASE("Prefetching", "[MinMaxHeap]") {
+	std::vector<int> values(5000);
+	std::iota(values.begin(), values.end(), 0);
+	std::shuffle(values.begin(), values.end(), std::mt19937{11});
+	MinMaxHeap<int, PrefetchPolicy> heap{values.cbegin(), values.cend()};
+
+	SECTION("Elements removed from a heap that prefetches descendants are in the correct order") {
+		for (auto low = 0, high = 4999; low <= high; ++low, --high) {
+			REQUIRE(heap.RemoveMin() == low);
+			REQUIRE(heap.RemoveMax() == high);
+		}
+	}
+}
+
+namespace {
+template <int Arity>
+struct ArityPolicy : MinMaxHeapPolicy {
+	static constexpr int kArity = Arity;
+};
+}
+
+TEMPLATE_TEST_CASE("Arity", "[MinMaxHeap]", ArityPolicy<4>, ArityPolicy<8>) {
+	std::vector<int> values(5000);
+	std::iota(values.begin(), values.end(), 0);
+	std::shuffle(values.begin(), values.end(), std::mt19937{13});
+
+	SECTION("Elements removed from a heap built from a collection are in the correct order") {
+		MinMaxHeap<int, TestType> heap{values.cbegin(), values.cend()};
+
+		for (auto low = 0, high = 4999; low <= high; ++low, --high) {
+			REQUIRE(heap.Min() == low);
+			REQUIRE(heap.Max() == high);
+			REQUIRE(heap.RemoveMin() == low);
+			REQUIRE(heap.RemoveMax() == high);
+		}
+	}
+
+	SECTION("Elements removed from a heap built by adding elements are in the correct order") {
+		MinMaxHeap<BranchingInt, TestType> heap;
+		for (const auto value : values) heap.Add(BranchingInt{value});
+
+		for (auto low = 0, high = 4999; low <= high; ++low, --high) {
+			REQUIRE(heap.RemoveMin().value == low);
+			REQUIRE(heap.RemoveMax().value == high);
+		}
+	}
+}
+
+namespace {
+template <int Arity>
+struct LeafPathPolicy : MinMaxHeapPolicy {
+	static constexpr int kArity = Arity;
+	static constexpr bool kLeafPathRemoval = true;
+};
+}
+
+TEMPLATE_TEST_CASE("Leaf path removal", "[MinMaxHeap]", LeafPathPolicy<2>, LeafPathPolicy<4>) {
+	std::mt19937 engine{19};
+	std::uniform_int_distribution distribution{0, 99};
+	MinMaxHeap<std::string, TestType> heap;
+	std::multiset<std::string> reference;
+
+	SECTION("Interleaved additions and removals agree with an ordered multiset") {
+		RequireAgreementUnderRandomOperations(heap, reference, engine, 4000, 70, [&](int) {
+			const auto value = std::to_string(distribution(engine));
+			heap.Add(value);
+			reference.insert(value);
+		});
+	}
+}
+
+namespace {
+template <int Arity>
+struct BinarySearchInsertionPolicy : MinMaxHeapPolicy {
+	static constexpr int kArity = Arity;
+	static constexpr bool kBinarySearchInsertion = true;
+};
+}
+
+TEMPLATE_TEST_CASE("Binary search insertion", "[MinMaxHeap]", BinarySearchInsertionPolicy<2>,
+	BinarySearchInsertionPolicy<4>) {
+
+	SECTION("Elements added in decreasing order climb to the root") {
+		MinMaxHeap<int, TestType> heap;
+		for (auto i = 999; i >= 0; --i) {
+			heap.Add(i);
+			REQUIRE(heap.Min() == i);
+			REQUIRE(heap.Max() == 999);
+		}
+	}
+
+	SECTION("Interleaved additions and removals agree with an ordered multiset") {
+		std::mt19937 engine{29};
+		std::uniform_int_distribution distribution{0, 99};
+		MinMaxHeap<int, TestType> heap;
+		std::multiset<int> reference;
+
+		RequireAgreementUnderRandomOperations(heap, reference, engine, 4000, 60, [&](int) {
+			const auto value = distribution(engine);
+			heap.Add(value);
+			reference.insert(value);
+		});
+	}
+}
+
+namespace {
+struct CountingInt {
+	static inline int comparisons = 0;
+
+	int value;
+	bool operator<(const CountingInt& other) const noexcept { return ++comparisons, value < other.value; }
+	bool operator>(const CountingInt& other) const noexcept { return ++comparisons, value > other.value; }
+};
+}
+
+TEMPLATE_TEST_CASE("Cached maximum", "[MinMaxHeap]", MinMaxHeapPolicy, ArityPolicy<4>, LeafPathPolicy<2>,
+	BinarySearchInsertionPolicy<4>) {
+
+	SECTION("Reading the maximum performs no comparisons") {
+		MinMaxHeap<CountingInt, TestType> heap;
+		for (auto i = 0; i < 100; ++i) heap.Add(CountingInt{i * 37 % 101});
+
+		CountingInt::comparisons = 0;
+		for (auto i = 0; i < 100; ++i) REQUIRE(heap.Max().value == 100);
+		REQUIRE(CountingInt::comparisons == 0);
+	}
+
+	SECTION("The maximum tracks small heaps with many duplicates") {
+		std::mt19937 engine{31};
+		std::uniform_int_distribution distribution{0, 9};
+		for (auto round = 0; round < 200; ++round) {
+			std::vector<int> values(round % 12);
+			for (auto& value : values) value = distribution(engine);
+			MinMaxHeap<int, TestType> heap{values.cbegin(), values.cend()};
+			std::multiset<int> reference{values.cbegin(), values.cend()};
+
+			RequireAgreementUnderRandomOperations(heap, reference, engine, 40, 60, [&](int) {
+				const auto value = distribution(engine);
+				heap.Add(value);
+				reference.insert(value);
+			});
+		}
+	}
+}
+
+namespace {
+template <int Threshold>
+struct SmallSizePolicy : MinMaxHeapPolicy {
+	static constexpr int kSmallSizeThreshold = Threshold;
+};
+}
+
+TEMPLATE_TEST_CASE("Small size threshold", "[MinMaxHeap]", SmallSizePolicy<0>, SmallSizePolicy<4>,
+	SmallSizePolicy<16>) {
+
+	SECTION("Heaps built around the threshold yield their elements in sorted order") {
+		for (auto n = 0; n <= 40; ++n) {
+			std::vector<int> values(n);
+			std::iota(values.begin(), values.end(), 0);
+			std::shuffle(values.begin(), values.end(), std::mt19937{static_cast<unsigned>(n)});
+			MinMaxHeap<int, TestType> heap{values.cbegin(), values.cend()};
+
+			for (auto low = 0, high = n - 1; low <= high; ++low, --high) {
+				REQUIRE(heap.RemoveMax() == high);
+				if (low < high) REQUIRE(heap.RemoveMin() == low);
+			}
+			REQUIRE(heap.Size() == 0);
+		}
+	}
+
+	SECTION("Growing and shrinking across the threshold agrees with an ordered multiset") {
+		std::mt19937 engine{37};
+		std::uniform_int_distribution distribution{0, 49};
+		MinMaxHeap<int, TestType> heap;
+		std::multiset<int> reference;
+
+		// drift between growing and shrinking phases so the size repeatedly crosses the threshold
+		for (auto phase = 0; phase < 200; ++phase) {
+			const auto remove_percent = phase % 2 == 0 ? 20 : 100;
+			RequireAgreementUnderRandomOperations(heap, reference, engine, 100, remove_percent, [&](int) {
+				const auto value = distribution(engine);
+				heap.Add(value);
+				reference.insert(value);
+			});
+		}
+	}
+}
+
+namespace {
+template <typename Index, int Arity = 2, bool LeafPathRemoval = false>
+struct IndexTypePolicy : MinMaxHeapPolicy {
+	using IndexType = Index;
+	static constexpr int kArity = Arity;
+	static constexpr bool kLeafPathRemoval = LeafPathRemoval;
+	static constexpr bool kBinarySearchInsertion = LeafPathRemoval;
+};
+}
+
+TEMPLATE_TEST_CASE("Index type", "[MinMaxHeap]", (IndexTypePolicy<std::uint8_t>), (IndexTypePolicy<std::uint8_t, 4>),
+	(IndexTypePolicy<std::uint8_t, 2, true>), (IndexTypePolicy<std::uint16_t, 4, true>),
+	(IndexTypePolicy<std::uint32_t>), (IndexTypePolicy<std::size_t, 4>)) {
+
+	using Index = typename TestType::IndexType;
+
+	SECTION("A heap filled up to the largest size its index type admits drains in sorted order") {
+		// child positions of the last nodes lie beyond the range of an 8-bit index
+		std::vector<int> values(254);
+		std::iota(values.begin(), values.end(), 0);
+		std::shuffle(values.begin(), values.end(), std::mt19937{41});
+		MinMaxHeap<int, TestType> heap;
+		for (const auto value : values) heap.Add(value);
+		REQUIRE(heap.Size() == Index{254});
+
+		for (auto low = 0, high = 253; low <= high; ++low, --high) {
+			REQUIRE(heap.RemoveMin() == low);
+			REQUIRE(heap.RemoveMax() == high);
+		}
+		REQUIRE(heap.Size() == Index{0});
+	}
+
+	SECTION("Interleaved additions and removals agree with an ordered multiset") {
+		std::mt19937 engine{43};
+		std::uniform_int_distribution distribution{0, 99};
+		MinMaxHeap<int, TestType> heap;
+		std::multiset<int> reference;
+
+		RequireAgreementUnderRandomOperations(heap, reference, engine, 5000, 60, [&](int) {
+			// the size stays within the range of an 8-bit index
+			if (reference.size() == 250) return;
+			const auto value = distribution(engine);
+			heap.Add(value);
+			reference.insert(value);
+		});
+	}
+}
+
+namespace {
+struct ShrinkPolicy : MinMaxHeapPolicy {
+	static constexpr int kShrinkAfterPops = 8;
+};
+}
+
+TEST_CASE("Capacity", "[MinMaxHeap]") {
+
+	SECTION("Reserving capacity does not change the contents") {
+		MinMaxHeap<int> heap{3, 1, 2};
+		heap.Reserve(1000);
+		REQUIRE(heap.Capacity() >= 1000);
+		REQUIRE(heap.Size() == 3);
+		REQUIRE(heap.Min() == 1);
+		REQUIRE(heap.Max() == 3);
+	}
+
+	SECTION("Clearing a heap keeps its capacity and leaves it ready for reuse") {
+		MinMaxHeap<int> heap;
+		for (auto i = 0; i < 1000; ++i) heap.Add(i);
+		const auto capacity = heap.Capacity();
+		heap.Clear();
+		REQUIRE(heap.Size() == 0);
+		REQUIRE(heap.Capacity() == capacity);
+
+		for (auto i = 10; i > 0; --i) heap.Add(i);
+		REQUIRE(heap.Min() == 1);
+		REQUIRE(heap.Max() == 10);
+		REQUIRE(heap.RemoveMax() == 10);
+	}
+
+	SECTION("Shrinking to fit keeps the elements") {
+		MinMaxHeap<int> heap;
+		for (auto i = 0; i < 1000; ++i) heap.Add(i);
+		for (auto i = 0; i < 900; ++i) heap.RemoveMin();
+		heap.ShrinkToFit();
+		REQUIRE(heap.Capacity() >= heap.Size());
+		REQUIRE(heap.Min() == 900);
+		REQUIRE(heap.Max() == 999);
+	}
+
+	SECTION("A heap releases capacity only after staying sparse for a number of removals") {
+		MinMaxHeap<int, ShrinkPolicy> heap;
+		for (auto i = 0; i < 1024; ++i) heap.Add(i);
+		for (auto i = 0; i < 1024 - 255; ++i) heap.RemoveMin();
+		const auto peak = heap.Capacity();
+
+		for (auto i = 0; i < 7; ++i) heap.RemoveMin();
+		REQUIRE(heap.Capacity() == peak);
+		heap.RemoveMax();
+		REQUIRE(heap.Capacity() == peak / 2);
+		REQUIRE(heap.Min() == 1024 - 255 + 7);
+		REQUIRE(heap.Max() == 1022);
+
+		// the halved capacity is no longer sparse, so further removals keep it
+		for (auto i = 0; i < 100; ++i) heap.RemoveMin();
+		REQUIRE(heap.Capacity() == peak / 2);
+	}
+}
+
+namespace {
+struct BlockedAdoptPolicy : MinMaxHeapPolicy {
+	template <typename U>
+	using Storage = BlockedStorage<U, 3>;
+};
+}
+
+TEST_CASE("Adopting and releasing storage", "[MinMaxHeap]") {
+	std::vector<int> values(1000);
+	std::iota(values.begin(), values.end(), 0);
+	std::shuffle(values.begin(), values.end(), std::mt19937{53});
+
+	SECTION("An adopted buffer is heapified in place") {
+		const auto* const buffer = values.data();
+		MinMaxHeap<int> heap{std::move(values)};
+		REQUIRE(heap.Size() == 1000);
+		REQUIRE(heap.Min() == 0);
+		REQUIRE(heap.Max() == 999);
+
+		const auto released = std::move(heap).Release();
+		REQUIRE(released.data() == buffer);
+		REQUIRE(heap.Size() == 0);
+
+		MinMaxHeap<int> copy{released.cbegin(), released.cend()};
+		for (auto low = 0, high = 999; low <= high; ++low, --high) {
+			REQUIRE(copy.RemoveMin() == low);
+			REQUIRE(copy.RemoveMax() == high);
+		}
+	}
+
+	SECTION("Taking the sorted elements reuses the buffer") {
+		const auto* const buffer = values.data();
+		MinMaxHeap<int> heap{std::move(values)};
+		heap.RemoveMin();
+
+		const auto sorted = std::move(heap).TakeSorted();
+		REQUIRE(sorted.data() == buffer);
+		REQUIRE(sorted.size() == 999);
+		for (auto i = 0; i < 999; ++i) REQUIRE(sorted[i] == i + 1);
+		REQUIRE(heap.Size() == 0);
+	}
+
+	SECTION("Small heaps hand back their elements in heap order") {
+		MinMaxHeap<int> heap{std::vector<int>{5, 3, 9, 1, 7}};
+		auto released = std::move(heap).Release();
+		REQUIRE(released.size() == 5);
+		REQUIRE(is_minmax_heap(released.begin(), released.end()));
+
+		pop_minmax_max(released.begin(), released.end());
+		REQUIRE(released.back() == 9);
+		pop_minmax_min(released.begin(), released.end() - 1);
+		REQUIRE(released[3] == 1);
+	}
+
+	SECTION("A heap over blocked storage adopts and hands back its buffer") {
+		MinMaxHeap<int, BlockedAdoptPolicy> heap{BlockedStorage<int, 3>{values.cbegin(), values.cend()}};
+		REQUIRE(heap.Min() == 0);
+		REQUIRE(heap.Max() == 999);
+
+		auto released = std::move(heap).Release();
+		REQUIRE(released.size() == 1000);
+		MinMaxHeap<int, BlockedAdoptPolicy> adopted{std::move(released)};
+		adopted.RemoveMax();
+		const auto sorted = std::move(adopted).TakeSorted();
+		REQUIRE(sorted.size() == 999);
+		for (auto i = 0; i < 999; ++i) REQUIRE(sorted[i] == i);
+
+		MinMaxHeap<int, BlockedAdoptPolicy> small{5, 3, 9, 1};
+		const auto small_sorted = std::move(small).TakeSorted();
+		REQUIRE(small_sorted.size() == 4);
+		REQUIRE((small_sorted[0] == 1 && small_sorted[1] == 3 && small_sorted[2] == 5 && small_sorted[3] == 9));
+	}
+
+	SECTION("Small heaps hand back their sorted elements") {
+		MinMaxHeap<int> heap{std::vector<int>{5, 3, 9, 1}};
+		REQUIRE(heap.Max() == 9);
+		REQUIRE(std::move(heap).TakeSorted() == std::vector<int>{1, 3, 5, 9});
+	}
+}
+
+TEST_CASE("Comparator", "[MinMaxHeap]") {
+	std::vector<int> values(100);
+	std::iota(values.begin(), values.end(), 0);
+	std::shuffle(values.begin(), values.end(), std::mt19937{61});
+
+	SECTION("A reversed comparator swaps the minimum and the maximum") {
+		MinMaxHeap<int, MinMaxHeapPolicy, std::greater<int>> heap{values.cbegin(), values.cend()};
+		for (auto i = 0; i < 50; ++i) {
+			REQUIRE(heap.RemoveMin() == 99 - i);
+			REQUIRE(heap.RemoveMax() == i);
+		}
+	}
+
+	SECTION("A stateful comparator is used for every comparison") {
+		auto comparisons = 0;
+		const auto compare = [&comparisons](const int a, const int b) { return ++comparisons, a < b; };
+		MinMaxHeap<int, MinMaxHeapPolicy, decltype(compare)> heap{values.cbegin(), values.cend(), compare};
+		REQUIRE(comparisons > 0);
+		REQUIRE(heap.RemoveMax() == 99);
+		REQUIRE(heap.Min() == 0);
+	}
+}
+
+namespace {
+template <int SmallSizeThreshold>
+struct LazyPolicy : MinMaxHeapPolicy {
+	static constexpr int kSmallSizeThreshold = SmallSizeThreshold;
+	static constexpr bool kLazyHeapify = true;
+};
+}
+
+TEMPLATE_TEST_CASE("Lazy heapification", "[MinMaxHeap]", LazyPolicy<16>, LazyPolicy<0>) {
+	std::vector<int> values(1000);
+	std::iota(values.begin(), values.end(), 0);
+	std::shuffle(values.begin(), values.end(), std::mt19937{73});
+
+	SECTION("Construction and additions perform no comparisons before the first query") {
+		std::vector<CountingInt> counted;
+		for (const auto value : values) counted.push_back(CountingInt{value});
+
+		CountingInt::comparisons = 0;
+		MinMaxHeap<CountingInt, TestType> heap{counted.cbegin(), counted.cend()};
+		for (auto i = 0; i < 1000; ++i) heap.Add(CountingInt{-i});
+		REQUIRE(CountingInt::comparisons == 0);
+		REQUIRE(heap.Size() == 2000);
+
+		REQUIRE(heap.Min().value == -999);
+		REQUIRE(heap.Max().value == 999);
+	}
+
+	SECTION("Bursts of additions of every size are folded in between queries") {
+		std::mt19937 engine{79};
+		std::uniform_int_distribution distribution{0, 10'000};
+		MinMaxHeap<int, TestType> heap{values.cbegin(), values.cend()};
+		// queries through a const reference fold the additions in as well
+		const auto& const_heap = heap;
+		std::multiset<int> reference{values.cbegin(), values.cend()};
+
+		for (const auto burst : {1, 3, 0, 700, 2, 5000, 10, 1}) {
+			for (auto i = 0; i < burst; ++i) {
+				const auto value = distribution(engine);
+				heap.Add(value);
+				reference.insert(value);
+			}
+			RequireAgreement(const_heap, reference);
+
+			for (auto i = 0; i < 100; ++i) {
+				RemoveMinFromBoth(heap, reference);
+				RemoveMaxFromBoth(heap, reference);
+			}
+		}
+	}
+
+	SECTION("Small lazy heaps stay sorted and are handed back in order") {
+		MinMaxHeap<int, TestType> heap{5, 3, 9};
+		REQUIRE(heap.RemoveMax() == 9);
+		heap.Add(1);
+		heap.Add(7);
+		REQUIRE(heap.Min() == 1);
+		heap.Add(0);
+		REQUIRE(std::move(heap).TakeSorted() == std::vector<int>{0, 1, 3, 5, 7});
+	}
+}
+
+TEST_CASE("Adding a range", "[MinMaxHeap]") {
+	std::vector<int> values(600);
+	std::iota(values.begin(), values.end(), 0);
+	std::shuffle(values.begin(), values.end(), std::mt19937{89});
+
+	SECTION("Batches small enough to sift and large enough to rebuild agree with an ordered multiset") {
+		MinMaxHeap<int> heap;
+		std::multiset<int> reference;
+		auto next = values.cbegin();
+		for (const auto batch : {3, 0, 20, 5, 200, 2, 370}) {
+			heap.AddRange(next, next + batch);
+			reference.insert(next, next + batch);
+			next += batch;
+
+			RequireAgreement(heap, reference);
+			if (heap.Size() > 0) RemoveMaxFromBoth(heap, reference);
+		}
+
+		for (auto low = reference.cbegin(); low != reference.cend(); ++low) REQUIRE(heap.RemoveMin() == *low);
+	}
+}
+
+TEST_CASE("Transforming all elements", "[MinMaxHeap]") {
+	std::vector<int> values(300);
+	std::iota(values.begin(), values.end(), -150);
+	std::shuffle(values.begin(), values.end(), std::mt19937{103});
+
+	SECTION("A non-decreasing transform keeps the heap order without rebuilding") {
+		MinMaxHeap<int> heap{values.cbegin(), values.cend()};
+		heap.TransformAll([](const int value) { return value < 0 ? value * 3 : value / 2; });
+		REQUIRE(heap.Min() == -450);
+		REQUIRE(heap.Max() == 74);
+
+		auto previous = heap.RemoveMin();
+		while (heap.Size() > 0) {
+			const auto next = heap.RemoveMin();
+			REQUIRE(previous <= next);
+			previous = next;
+		}
+	}
+
+	SECTION("Small sorted heaps stay sorted") {
+		MinMaxHeap<int> heap{4, 1, 3};
+		heap.TransformAll([](const int value) { return value * 10; });
+		REQUIRE(heap.RemoveMax() == 40);
+		REQUIRE(heap.RemoveMin() == 10);
+		REQUIRE(heap.Max() == 30);
+	}
+}
@@ -0,0 +1,95 @@
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "offset_min_max_heap.hpp"
+#include "reference_check.hpp"
+
+TEST_CASE("Global offset", "[OffsetMinMaxHeap]") {
+
+	SECTION("Shifting all elements moves both extremes") {
+		OffsetMinMaxHeap<int> heap{5, -2, 9};
+		heap.ShiftAll(10);
+		REQUIRE(heap.Min() == 8);
+		REQUIRE(heap.Max() == 19);
+
+		heap.Add(12);
+		heap.ShiftAll(-20);
+		REQUIRE(heap.RemoveMin() == -12);
+		REQUIRE(heap.RemoveMin() == -8);
+		REQUIRE(heap.RemoveMax() == -1);
+		REQUIRE(heap.RemoveMin() == -5);
+		REQUIRE(heap.Size() == 0);
+	}
+
+	SECTION("A transform applies the pending offset first") {
+		OffsetMinMaxHeap<double, MinMaxHeapPolicy, std::greater<double>> heap{1.0, 2.0, 4.0};
+		heap.ShiftAll(1.0);
+		heap.TransformAll([](const double value) { return value * 0.5; });
+		REQUIRE(heap.Min() == 2.5);
+		REQUIRE(heap.Max() == 1.0);
+
+		heap.ShiftAll(0.25);
+		heap.Rebase();
+		REQUIRE(heap.RemoveMin() == 2.75);
+		REQUIRE(heap.RemoveMin() == 1.75);
+	}
+
+	SECTION("An integer offset that would overflow is folded into the elements first") {
+		OffsetMinMaxHeap<int> heap{-2'000'000'000};
+		heap.ShiftAll(2'000'000'000);
+		heap.ShiftAll(1'000'000'000);
+		REQUIRE(heap.Max() == 1'000'000'000);
+
+		heap.Add(-2'000'000'000);
+		REQUIRE(heap.Min() == -2'000'000'000);
+		REQUIRE(heap.RemoveMax() == 1'000'000'000);
+		REQUIRE(heap.RemoveMax() == -2'000'000'000);
+	}
+
+	SECTION("Aging narrow integers far past the range of the type agrees with an ordered multiset") {
+		OffsetMinMaxHeap<std::int8_t> heap{-100, -50, 0, 60};
+		std::multiset<int> reference{-100, -50, 0, 60};
+
+		for (auto step = 0; step < 2000; ++step) {
+			heap.ShiftAll(1);
+			std::multiset<int> shifted;
+			for (const auto value : reference) shifted.insert(value + 1);
+			reference = std::move(shifted);
+
+			// elements leave at the top of the range and fresh ones enter at the bottom
+			if (*reference.rbegin() == 100) {
+				RemoveMaxFromBoth(heap, reference);
+				heap.Add(-100);
+				reference.insert(-100);
+			}
+			RequireAgreement(heap, reference);
+		}
+	}
+
+	SECTION("Interleaved shifts, additions and removals agree with an ordered multiset") {
+		std::mt19937 engine{107};
+		std::uniform_int_distribution distribution{-1000, 1000};
+		OffsetMinMaxHeap<std::int64_t> heap;
+		std::multiset<std::int64_t> reference;
+
+		RequireAgreementUnderRandomOperations(heap, reference, engine, 5000, 25, [&](const int draw) {
+			if (draw < 75) {
+				const auto value = distribution(engine);
+				heap.Add(value);
+				reference.insert(value);
+			} else {
+				const auto delta = distribution(engine);
+				heap.ShiftAll(delta);
+				std::multiset<std::int64_t> shifted;
+				for (const auto value : reference) shifted.insert(value + delta);
+				reference = std::move(shifted);
+			}
+		});
+	}
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+
+#include "catch.hpp"
+
+// Checks of a double-ended priority queue against an ordered multiset holding the same elements, whose ordering
+// must agree with the comparator of the queue.
+
+template <typename Queue, typename Reference>
+void RequireAgreement(const Queue& queue, const Reference& reference) {
+	REQUIRE(static_cast<std::size_t>(queue.Size()) == reference.size());
+	if (!reference.empty()) {
+		REQUIRE(queue.Min() == *reference.begin());
+		REQUIRE(queue.Max() == *reference.rbegin());
+	}
+}
+
+template <typename Queue, typename Reference>
+void RemoveMinFromBoth(Queue& queue, Reference& reference) {
+	REQUIRE(queue.RemoveMin() == *reference.begin());
+	reference.erase(reference.begin());
+}
+
+template <typename Queue, typename Reference>
+void RemoveMaxFromBoth(Queue& queue, Reference& reference) {
+	REQUIRE(queue.RemoveMax() == *reference.rbegin());
+	reference.erase(std::prev(reference.end()));
+}
+
+// Runs steps random operations on queue and reference and requires them to agree after every one. Each step draws
+// a number below 100: a draw below remove_percent removes the minimum, or the maximum if the draw is odd, from a
+// nonempty queue, and any other draw is passed to operate, which applies the same change to both, usually an Add.
+template <typename Queue, typename Reference, typename Engine, typename Operate>
+void RequireAgreementUnderRandomOperations(Queue& queue, Reference& reference, Engine& engine, const int steps,
+	const int remove_percent, Operate&& operate) {
+	for (auto step = 0; step < steps; ++step) {
+		const auto draw = static_cast<int>(engine() % 100);
+		if (draw < remove_percent && !reference.empty()) {
+			if (draw % 2 == 0) {
+				RemoveMinFromBoth(queue, reference);
+			} else {
+				RemoveMaxFromBoth(queue, reference);
+			}
+		} else {
+			operate(draw);
+		}
+		RequireAgreement(queue, reference);
+	}
+}
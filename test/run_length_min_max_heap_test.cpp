@@ -0,0 +1,59 @@
+#include <random>
+#include <set>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "run_length_min_max_heap.hpp"
+#include "reference_check.hpp"
+
+TEST_CASE("Run-length encoding", "[RunLengthMinMaxHeap]") {
+
+	SECTION("Duplicates are counted rather than stored") {
+		RunLengthMinMaxHeap<int> heap{7, 3, 7, 7, 9, 3};
+		REQUIRE(heap.Size() == 6);
+		REQUIRE(heap.DistinctSize() == 3);
+		REQUIRE(heap.CountOf(7) == 3);
+		REQUIRE(heap.CountOf(4) == 0);
+
+		heap.Add(9, 4);
+		heap.Add(1);
+		REQUIRE(heap.Size() == 11);
+		REQUIRE(heap.DistinctSize() == 4);
+		REQUIRE(heap.Min() == 1);
+		REQUIRE(heap.Max() == 9);
+	}
+
+	SECTION("Removing a key keeps it at the end until its last copy is gone") {
+		RunLengthMinMaxHeap<int> heap{2, 2, 5, 8, 8, 8};
+		REQUIRE(heap.RemoveMin() == 2);
+		REQUIRE(heap.Min() == 2);
+		REQUIRE(heap.RemoveMin() == 2);
+		REQUIRE(heap.Min() == 5);
+		REQUIRE(heap.DistinctSize() == 2);
+
+		REQUIRE(heap.RemoveMax() == 8);
+		REQUIRE(heap.RemoveMax() == 8);
+		REQUIRE(heap.RemoveMax() == 8);
+		REQUIRE(heap.Max() == 5);
+		REQUIRE(heap.RemoveMax() == 5);
+		REQUIRE(heap.Size() == 0);
+		REQUIRE(heap.DistinctSize() == 0);
+	}
+
+	SECTION("Many entries over few keys agree with an ordered multiset") {
+		std::mt19937 engine{109};
+		std::uniform_int_distribution distribution{0, 40};
+		RunLengthMinMaxHeap<int> heap;
+		std::multiset<int> reference;
+
+		RequireAgreementUnderRandomOperations(heap, reference, engine, 20'000, 40, [&](const int draw) {
+			// some additions bring several copies at once
+			const auto value = distribution(engine);
+			const auto count = draw < 90 ? 1 : draw - 88;
+			heap.Add(value, static_cast<RunLengthMinMaxHeap<int>::Count>(count));
+			for (auto i = 0; i < count; ++i) reference.insert(value);
+		});
+		REQUIRE(heap.DistinctSize() <= 41);
+	}
+}
@@ -0,0 +1,70 @@
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <ratio>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "reference_check.hpp"
+#include "tombstone_min_max_heap.hpp"
+
+TEMPLATE_TEST_CASE("Tombstones", "[TombstoneMinMaxHeap]", (std::ratio<1, 2>), (std::ratio<1, 10>)) {
+	TombstoneMinMaxHeap<int> heap{std::less<int>{}, static_cast<double>(TestType::num) / TestType::den};
+	std::vector<TombstoneMinMaxHeap<int>::Handle> handles;
+	for (auto i = 0; i < 10; ++i) handles.push_back(heap.Add(i));
+
+	SECTION("Deleted elements are skipped at both ends") {
+		heap.MarkDeleted(handles[0]);
+		heap.MarkDeleted(handles[9]);
+		heap.MarkDeleted(handles[1]);
+		REQUIRE(heap.Size() == 7);
+		REQUIRE(!heap.IsLive(handles[0]));
+		REQUIRE(heap.IsLive(handles[2]));
+		REQUIRE(heap.Min() == 2);
+		REQUIRE(heap.Max() == 8);
+		REQUIRE(heap.RemoveMax() == 8);
+		REQUIRE(heap.RemoveMin() == 2);
+	}
+
+	SECTION("Deleting most elements compacts the heap and keeps the survivors") {
+		for (auto i = 0; i < 10; ++i) {
+			if (i != 4 && i != 6) heap.MarkDeleted(handles[i]);
+		}
+		REQUIRE(heap.Size() == 2);
+		REQUIRE(heap.RemoveMin() == 4);
+		REQUIRE(heap.RemoveMin() == 6);
+		REQUIRE(heap.Size() == 0);
+	}
+
+	SECTION("Cancelling a random share of elements agrees with an ordered multiset") {
+		std::mt19937 engine{97};
+		std::uniform_int_distribution distribution{0, 1000};
+		std::vector<std::pair<int, TombstoneMinMaxHeap<int>::Handle>> live;
+		std::multiset<int> reference;
+		for (auto i = 0; i < 10; ++i) {
+			live.emplace_back(i, handles[i]);
+			reference.insert(i);
+		}
+
+		RequireAgreementUnderRandomOperations(heap, reference, engine, 20'000, 20, [&](const int draw) {
+			// removals free the handles of the removed elements, which the next Add may hand out again
+			const auto removed = [&](const auto& entry) { return !heap.IsLive(entry.second); };
+			live.erase(std::remove_if(live.begin(), live.end(), removed), live.end());
+
+			if (draw < 70 || live.empty()) {
+				const auto value = distribution(engine);
+				live.emplace_back(value, heap.Add(value));
+				reference.insert(value);
+			} else {
+				const auto index = engine() % live.size();
+				heap.MarkDeleted(live[index].second);
+				reference.erase(reference.find(live[index].first));
+				live[index] = live.back();
+				live.pop_back();
+			}
+		});
+	}
+}